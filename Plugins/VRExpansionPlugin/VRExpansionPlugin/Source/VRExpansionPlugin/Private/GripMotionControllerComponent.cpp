@@ -10,6 +10,7 @@
 #include "GameFramework/WorldSettings.h"
 #include "IXRSystemAssets.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/ShapeComponent.h"
 #include "MotionDelayBuffer.h"
 #include "UObject/VRObjectVersion.h"
 #include "UObject/UObjectGlobals.h" // for FindObject<>
@@ -18,6 +19,8 @@
 #include "DrawDebugHelpers.h"
 #include "TimerManager.h"
 #include "VRBaseCharacter.h"
+#include "Misc/VRGripJournal.h"
+#include "Misc/VRPoseSource.h"
 
 #include "GripScripts/GS_Default.h"
 
@@ -38,6 +41,8 @@ DEFINE_LOG_CATEGORY(LogVRMotionController);
 //For UE4 Profiler ~ Stat
 DECLARE_CYCLE_STAT(TEXT("TickGrip ~ TickingGrip"), STAT_TickGrip, STATGROUP_TickGrip);
 DECLARE_CYCLE_STAT(TEXT("GetGripWorldTransform ~ GettingTransform"), STAT_GetGripTransform, STATGROUP_TickGrip);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Physics Grip Handles Active"), STAT_PhysicsGripHandlesActive, STATGROUP_TickGrip);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Physics Grip Handles Pooled"), STAT_PhysicsGripHandlesPooled, STATGROUP_TickGrip);
 
 // MAGIC NUMBERS
 // Constraint multipliers for angular, to avoid having to have two sets of stiffness/damping variables
@@ -64,6 +69,22 @@ namespace GripMotionControllerCvars
 		TEXT("When on, will draw debug speheres for physics grips COM.\n")
 		TEXT("0: Disable, 1: Enable"),
 		ECVF_Default);
+
+	static int32 PhysicsGripPoolSize = 8;
+	FAutoConsoleVariableRef CVarPhysicsGripPoolSize(
+		TEXT("vr.PhysicsGripPoolSize"),
+		PhysicsGripPoolSize,
+		TEXT("Max number of released physics grip kinematic actors / joints to keep around per physics scene for re-use.\n")
+		TEXT("0: Disable pooling"),
+		ECVF_Default);
+
+	static int32 LateUpdateCacheRefreshFrames = 90;
+	FAutoConsoleVariableRef CVarLateUpdateCacheRefreshFrames(
+		TEXT("vr.LateUpdateCacheRefreshFrames"),
+		LateUpdateCacheRefreshFrames,
+		TEXT("Number of frames the cached late update primitives are kept before being re-gathered anyway, catches attachment changes deep in held objects.\n")
+		TEXT("0: Re-gather every frame"),
+		ECVF_Default);
 }
 
   //=============================================================================
@@ -81,6 +102,9 @@ UGripMotionControllerComponent::UGripMotionControllerComponent(const FObjectInit
 	bDisableLowLatencyUpdate = false;
 	bHasAuthority = false;
 	bUseWithoutTracking = false;
+	LateUpdateGeneration = 0;
+	PoseSource = nullptr;
+	GripSweepMode = EVRGripSweepMode::Sync;
 	bAlwaysSendTickGrip = false;
 	bAutoActivate = true;
 
@@ -93,9 +117,14 @@ UGripMotionControllerComponent::UGripMotionControllerComponent(const FObjectInit
 	bReplicateWithoutTracking = false;
 	bLerpingPosition = false;
 	bSmoothReplicatedMotion = false;
+	bUseJitterBuffer = false;
+	JitterBufferPlayoutDelay = 0.05f;
+	MaxExtrapolationTime = 0.1f;
+	RemoteSampleTimeStamp = -1.0f;
 	bReppedOnce = false;
 	bOffsetByHMD = false;
 	bIsPostTeleport = false;
+	bReplicatesWithOwnerPose = false;
 
 	GripIDIncrementer = INVALID_VRGRIP_ID;
 
@@ -173,6 +202,18 @@ void UGripMotionControllerComponent::InitializeComponent()
 		DefaultGripScript = GetMutableDefault<UGS_Default>();
 }
 
+void UGripMotionControllerComponent::OnChildAttached(USceneComponent* ChildComponent)
+{
+	Super::OnChildAttached(ChildComponent);
+	MarkLateUpdatePrimitivesDirty();
+}
+
+void UGripMotionControllerComponent::OnChildDetached(USceneComponent* ChildComponent)
+{
+	Super::OnChildDetached(ChildComponent);
+	MarkLateUpdatePrimitivesDirty();
+}
+
 void UGripMotionControllerComponent::OnUnregister()
 {
 
@@ -308,10 +349,17 @@ void UGripMotionControllerComponent::PreReplication(IRepChangedPropertyTracker &
 	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, false);
 	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, false);
 	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, false);
+
+	// The owning character replicates this as part of its pose instead
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UGripMotionControllerComponent, ReplicatedControllerTransform, !bReplicatesWithOwnerPose);
 }
 
 void UGripMotionControllerComponent::Server_SendControllerTransform_Implementation(FBPVRComponentPosRep NewTransform)
 {
+	// Based on a keyframe that never arrived, wait for the next one
+	if (!NetDeltaState.Decode(NewTransform))
+		return;
+
 	// Store new transform and trigger OnRep_Function
 	ReplicatedControllerTransform = NewTransform;
 
@@ -320,6 +368,12 @@ void UGripMotionControllerComponent::Server_SendControllerTransform_Implementati
 		OnRep_ReplicatedControllerTransform();
 }
 
+void UGripMotionControllerComponent::AddNetSmoothingSample()
+{
+	const float LocalTime = GetWorld()->GetTimeSeconds();
+	NetSmoothingBuffer.AddSample(RemoteSampleTimeStamp >= 0.0f ? RemoteSampleTimeStamp : LocalTime, LocalTime, ReplicatedControllerTransform);
+}
+
 bool UGripMotionControllerComponent::Server_SendControllerTransform_Validate(FBPVRComponentPosRep NewTransform)
 {
 	return true;
@@ -725,6 +779,9 @@ FTransform UGripMotionControllerComponent::CreateGripRelativeAdditionTransform_B
 
 bool UGripMotionControllerComponent::HandleGripReplication(FBPActorGripInformation & Grip)
 {
+	if (FVRGripJournal::IsRecording())
+		FVRGripJournal::Get().RecordGripEvent(EVRGripJournalRecordType::GripReplication, this, Grip);
+
 	if (Grip.ValueCache.bWasInitiallyRepped && Grip.GripID != Grip.ValueCache.CachedGripID)
 	{
 		// There appears to be a bug with TArray replication where if you replace an index with another value of that
@@ -1818,6 +1875,8 @@ void UGripMotionControllerComponent::NotifyDropAndSocket_Implementation(const FB
 
 void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActorGripInformation &NewDrop)
 {
+	MarkLateUpdatePrimitivesDirty();
+
 	UGripMotionControllerComponent * HoldingController = nullptr;
 	bool bIsHeld = false;
 
@@ -1982,7 +2041,10 @@ void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActor
 			LocallyGrippedObjects.RemoveAt(fIndex);
 		}
 		else
+		{
 			LocallyGrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
+			LocallyGrippedObjects[fIndex].ValueCache.bInterfaceCacheValid = false;
+		}
 	}
 	else
 	{
@@ -1994,7 +2056,10 @@ void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActor
 				GrippedObjects.RemoveAt(fIndex);
 			}
 			else
+			{
 				GrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
+				GrippedObjects[fIndex].ValueCache.bInterfaceCacheValid = false;
+			}
 		}
 	}
 
@@ -2003,9 +2068,58 @@ void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActor
 }
 
 
+void UGripMotionControllerComponent::CacheGripInterfaceData(FBPActorGripInformation &Grip, UPrimitiveComponent * root, AActor * actor)
+{
+	FBPActorGripInformation::FGripValueCache & Cache = Grip.ValueCache;
+
+	Cache.CachedInterfaceObject = Grip.GrippedObject;
+	Cache.CachedInterfaceRoot = root;
+	Cache.bCachedRootHasInterface = root && root->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass());
+
+	// Actor grip interface is checked after component
+	Cache.bCachedActorHasInterface = actor && actor->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass());
+
+	Cache.CachedGripScripts.Reset();
+	if (Cache.bCachedRootHasInterface)
+	{
+		IVRGripInterface::Execute_GetGripScripts(root, Cache.CachedGripScripts);
+	}
+	else if (Cache.bCachedActorHasInterface)
+	{
+		IVRGripInterface::Execute_GetGripScripts(actor, Cache.CachedGripScripts);
+	}
+
+	// Null entries stay in the raw array, only live scripts need to be tracked
+	Cache.CachedGripScriptRefs.Reset();
+	for (UVRGripScriptBase* Script : Cache.CachedGripScripts)
+	{
+		if (Script)
+			Cache.CachedGripScriptRefs.Add(Script);
+	}
+
+	Cache.bInterfaceCacheValid = true;
+}
+
+void UGripMotionControllerComponent::InvalidateGripInterfaceCache(const FBPActorGripInformation &Grip)
+{
+	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(Grip.GripID);
+	if (!GripInfo)
+		GripInfo = LocallyGrippedObjects.FindByKey(Grip.GripID);
+
+	if (GripInfo)
+	{
+		GripInfo->ValueCache.bInterfaceCacheValid = false;
+	}
+}
+
 // No longer an RPC, now is called from RepNotify so that joining clients also correctly set up grips
 bool UGripMotionControllerComponent::NotifyGrip(FBPActorGripInformation &NewGrip, bool bIsReInit)
 {
+	MarkLateUpdatePrimitivesDirty();
+
+	if (!bIsReInit && FVRGripJournal::IsRecording())
+		FVRGripJournal::Get().RecordGripEvent(EVRGripJournalRecordType::Grip, this, NewGrip);
+
 	UPrimitiveComponent *root = NULL;
 	AActor *pActor = NULL;
 
@@ -2125,6 +2239,9 @@ bool UGripMotionControllerComponent::NotifyGrip(FBPActorGripInformation &NewGrip
 	}break;
 	}
 
+	if (root && pActor)
+		CacheGripInterfaceData(NewGrip, root, pActor);
+
 	switch (NewGrip.GripMovementReplicationSetting)
 	{
 	case EGripMovementReplicationSettings::ForceClientSideMovement:
@@ -2252,6 +2369,10 @@ void UGripMotionControllerComponent::NotifyDrop_Implementation(const FBPActorGri
 
 void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInformation &NewDrop, bool bSimulate)
 {
+	MarkLateUpdatePrimitivesDirty();
+
+	if (FVRGripJournal::IsRecording())
+		FVRGripJournal::Get().RecordGripEvent(EVRGripJournalRecordType::Drop, this, NewDrop, bSimulate);
 
 	bool bSkipFullDrop = false;
 	UGripMotionControllerComponent * HoldingController = nullptr;
@@ -2520,7 +2641,10 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 			LocallyGrippedObjects.RemoveAt(fIndex);
 		}
 		else
+		{
 			LocallyGrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
+			LocallyGrippedObjects[fIndex].ValueCache.bInterfaceCacheValid = false;
+		}
 	}
 	else
 	{
@@ -2532,7 +2656,10 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 				GrippedObjects.RemoveAt(fIndex);
 			}
 			else
+			{
 				GrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
+				GrippedObjects[fIndex].ValueCache.bInterfaceCacheValid = false;
+			}
 		}
 	}
 
@@ -3150,7 +3277,19 @@ void UGripMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelT
 		FVector Position;
 		FRotator Orientation;
 
-		if (!bUseWithoutTracking)
+		if (PoseSource)
+		{
+			// Poses are coming from a file or generator instead of the XR system
+			const bool bNewTrackedState = PoseSource->GetPose(this, DeltaTime, Position, Orientation);
+
+			if (bNewTrackedState)
+			{
+				SetRelativeTransform(FTransform(Orientation, Position, this->RelativeScale3D));
+			}
+
+			bTracked = bNewTrackedState;
+		}
+		else if (!bUseWithoutTracking)
 		{
 			if (!GripViewExtension.IsValid() && GEngine)
 			{
@@ -3179,8 +3318,11 @@ void UGripMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelT
 		if (!bTracked && !bUseWithoutTracking)
 			return; // Don't update anything including location
 
-		// Don't bother with any of this if not replicating transform
-		if (bReplicates && (bTracked || bReplicateWithoutTracking))
+		if (FVRGripJournal::IsRecording())
+			FVRGripJournal::Get().RecordPose(this);
+
+		// Don't bother with any of this if not replicating transform, the owning character handles it if we are part of its combined pose
+		if (bReplicates && !bReplicatesWithOwnerPose && (bTracked || bReplicateWithoutTracking))
 		{
 			// Don't rep if no changes
 			if (!this->RelativeLocation.Equals(ReplicatedControllerTransform.Position) || !this->RelativeRotation.Equals(ReplicatedControllerTransform.Rotation))
@@ -3198,7 +3340,9 @@ void UGripMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelT
 					// Set 100 htz updates, and in the TornOff case, it actually can't hurt any besides some small
 					// Perf difference.
 					if (GetNetMode() == NM_Client/* && !IsTornOff()*/)
-					{		
+					{
+						NetDeltaState.Encode(ReplicatedControllerTransform);
+
 						AVRBaseCharacter * OwningChar = Cast<AVRBaseCharacter>(GetOwner());
 						if (OverrideSendTransform != nullptr && OwningChar != nullptr)
 						{
@@ -3213,7 +3357,15 @@ void UGripMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelT
 	}
 	else
 	{
-		if (bLerpingPosition)
+		if (bSmoothReplicatedMotion && bUseJitterBuffer)
+		{
+			FVector SmoothedPosition;
+			FRotator SmoothedRotation;
+
+			if (NetSmoothingBuffer.Evaluate(GetWorld()->GetTimeSeconds(), JitterBufferPlayoutDelay, MaxExtrapolationTime, SmoothedPosition, SmoothedRotation))
+				SetRelativeLocationAndRotation(SmoothedPosition, SmoothedRotation);
+		}
+		else if (bLerpingPosition)
 		{
 			ControllerNetUpdateCount += DeltaTime;
 			float LerpVal = FMath::Clamp(ControllerNetUpdateCount / (1.0f / ControllerNetUpdateRate), 0.0f, 1.0f);
@@ -3314,504 +3466,702 @@ void UGripMotionControllerComponent::TickGrip(float DeltaTime)
 
 	FTransform ParentTransform = this->GetComponentTransform();
 
+	// Gather both arrays up front so that all of the base transforms get composed in one pass
 	// Split into separate functions so that I didn't have to combine arrays since I have some removal going on
-	HandleGripArray(GrippedObjects, ParentTransform, DeltaTime, true);
-	HandleGripArray(LocallyGrippedObjects, ParentTransform, DeltaTime);
+	GripTickBatch.Reset();
+	GatherGripArray(GrippedObjects, true);
+	GatherGripArray(LocallyGrippedObjects);
+
+	GripTickBatch.ComposeWorldTransforms(ParentTransform);
+	ProcessGripBatch(ParentTransform, DeltaTime);
+
+	// Drop async sweeps for components that didn't sweep this frame (released or switched grip types)
+	if (GripAsyncSweeps.Num())
+	{
+		for (auto It = GripAsyncSweeps.CreateIterator(); It; ++It)
+		{
+			if (It.Value().LastUsedFrame != GFrameCounter || !It.Key().IsValid())
+				It.RemoveCurrent();
+		}
+	}
 
 	// Empty out the teleport flag
 	bIsPostTeleport = false;
 }
 
-void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformation> &GrippedObjectsArray, const FTransform & ParentTransform, float DeltaTime, bool bReplicatedArray)
+FGripTickEntry & FGripTickBatch::AddEntry(const FTransform & RelativeTransform, const FTransform & AdditionTransform)
 {
-	if (GrippedObjectsArray.Num())
-	{
-		FTransform WorldTransform;
+	RelativeRotations.Add(RelativeTransform.GetRotation());
+	RelativeTranslations.Add(RelativeTransform.GetTranslation());
+	RelativeScales.Add(RelativeTransform.GetScale3D());
+	AdditionRotations.Add(AdditionTransform.GetRotation());
+	AdditionTranslations.Add(AdditionTransform.GetTranslation());
+	AdditionScales.Add(AdditionTransform.GetScale3D());
+	NeedsMatrixCompose.Add(RelativeScales.Last().GetMin() < 0.0f || AdditionScales.Last().GetMin() < 0.0f);
+
+	return Entries[Entries.AddDefaulted()];
+}
 
-		for (int i = GrippedObjectsArray.Num() - 1; i >= 0; --i)
+void FGripTickBatch::ComposeWorldTransforms(const FTransform & ParentTransform)
+{
+	const int32 NumGrips = Entries.Num();
+	WorldTransforms.SetNumUninitialized(NumGrips);
+
+	const FQuat ParentQuat = ParentTransform.GetRotation();
+	const FVector ParentTranslation = ParentTransform.GetTranslation();
+	const FVector ParentScale = ParentTransform.GetScale3D();
+	const bool bParentNeedsMatrixCompose = ParentScale.GetMin() < 0.0f;
+
+	// Parent is the same for every grip, only load it once
+	const VectorRegister ParentRotationReg = VectorLoad(&ParentQuat);
+	const VectorRegister ParentTranslationReg = VectorLoadFloat3_W0(&ParentTranslation);
+	const VectorRegister ParentScaleReg = VectorLoadFloat3_W0(&ParentScale);
+
+	FQuat OutRotation;
+	FVector OutTranslation;
+	FVector OutScale;
+
+	for (int32 i = 0; i < NumGrips; ++i)
+	{
+		if (bParentNeedsMatrixCompose || NeedsMatrixCompose[i])
 		{
-			if (!HasGripMovementAuthority(GrippedObjectsArray[i]))
-				continue;
+			WorldTransforms[i] = FTransform(RelativeRotations[i], RelativeTranslations[i], RelativeScales[i]) * FTransform(AdditionRotations[i], AdditionTranslations[i], AdditionScales[i]) * ParentTransform;
+			continue;
+		}
 
-			FBPActorGripInformation * Grip = &GrippedObjectsArray[i];
+		const VectorRegister RelativeRotationReg = VectorLoad(&RelativeRotations[i]);
+		const VectorRegister RelativeTranslationReg = VectorLoadFloat3_W0(&RelativeTranslations[i]);
+		const VectorRegister RelativeScaleReg = VectorLoadFloat3_W0(&RelativeScales[i]);
+		const VectorRegister AdditionRotationReg = VectorLoad(&AdditionRotations[i]);
+		const VectorRegister AdditionTranslationReg = VectorLoadFloat3_W0(&AdditionTranslations[i]);
+		const VectorRegister AdditionScaleReg = VectorLoadFloat3_W0(&AdditionScales[i]);
 
-			
-			if (!Grip) // Shouldn't be possible, but why not play it safe
-				continue;
+		// Relative * Addition, same as FTransform::Multiply
+		const VectorRegister LocalRotationReg = VectorQuaternionMultiply2(AdditionRotationReg, RelativeRotationReg);
+		const VectorRegister LocalScaleReg = VectorMultiply(RelativeScaleReg, AdditionScaleReg);
+		const VectorRegister LocalTranslationReg = VectorAdd(VectorQuaternionRotateVector(AdditionRotationReg, VectorMultiply(AdditionScaleReg, RelativeTranslationReg)), AdditionTranslationReg);
 
-			// Double checking here for a failed rep due to out of order replication from a spawned actor
-			if (!Grip->ValueCache.bWasInitiallyRepped && !HasGripAuthority(*Grip) && !HandleGripReplication(*Grip))
-				continue; // If we didn't successfully handle the replication (out of order) then continue on.
+		// * Parent
+		const VectorRegister WorldRotationReg = VectorQuaternionMultiply2(ParentRotationReg, LocalRotationReg);
+		const VectorRegister WorldScaleReg = VectorMultiply(LocalScaleReg, ParentScaleReg);
+		const VectorRegister WorldTranslationReg = VectorAdd(VectorQuaternionRotateVector(ParentRotationReg, VectorMultiply(ParentScaleReg, LocalTranslationReg)), ParentTranslationReg);
 
-			// Continue if the grip is paused
-			if (Grip->bIsPaused)
-				continue;
+		VectorStoreAligned(WorldRotationReg, &OutRotation);
+		VectorStoreFloat3(WorldTranslationReg, &OutTranslation);
+		VectorStoreFloat3(WorldScaleReg, &OutScale);
 
-			if (Grip->GripID != INVALID_VRGRIP_ID && Grip->GrippedObject && !Grip->GrippedObject->IsPendingKill())
-			{
-				UPrimitiveComponent *root = NULL;
-				AActor *actor = NULL;
+		WorldTransforms[i] = FTransform(OutRotation, OutTranslation, OutScale);
+	}
+}
 
-				// Getting the correct variables depending on the grip target type
-				switch (Grip->GripTargetType)
-				{
-					case EGripTargetType::ActorGrip:
-					//case EGripTargetType::InteractibleActorGrip:
-					{
-						actor = Grip->GetGrippedActor();
-						if(actor)
-							root = Cast<UPrimitiveComponent>(actor->GetRootComponent());
-					}break;
+namespace GripMotionControllerCvars
+{
+	// Times the batched grip transform composition against composing each grip on its own
+	static void BenchmarkGripTransformBatch(const TArray<FString>& Args)
+	{
+		const int32 TotalGripsPerRun = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000000, 1);
+		const int32 GripCounts[] = { 2, 8, 32 };
 
-					case EGripTargetType::ComponentGrip:
-					//case EGripTargetType::InteractibleComponentGrip :
-					{
-						root = Grip->GetGrippedComponent();
-						if(root)
-							actor = root->GetOwner();
-					}break;
+		FRandomStream Stream(1234);
+		const FTransform ParentTransform(FRotator(10.0f, 45.0f, -5.0f), FVector(100.0f, -50.0f, 120.0f));
 
-				default:break;
-				}
+		for (int32 NumGrips : GripCounts)
+		{
+			FGripTickBatch Batch;
+			TArray<FTransform> RelativeTransforms;
+			TArray<FTransform> AdditionTransforms;
+			TArray<FTransform> ScalarResults;
+			ScalarResults.SetNum(NumGrips);
 
-				// Last check to make sure the variables are valid
-				if (!root || !actor)
-					continue;
+			for (int32 i = 0; i < NumGrips; ++i)
+			{
+				RelativeTransforms.Add(FTransform(FRotator(Stream.FRandRange(-180.0f, 180.0f), Stream.FRandRange(-180.0f, 180.0f), Stream.FRandRange(-180.0f, 180.0f)), Stream.VRand() * 20.0f, FVector(Stream.FRandRange(0.5f, 2.0f))));
+				AdditionTransforms.Add(FTransform(FRotator(0.0f, Stream.FRandRange(-30.0f, 30.0f), 0.0f), Stream.VRand() * 2.0f));
+				Batch.AddEntry(RelativeTransforms[i], AdditionTransforms[i]);
+			}
 
-				// Check if either implements the interface
-				bool bRootHasInterface = false;
-				bool bActorHasInterface = false;
-				
-				if (root->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
+			const int32 NumIterations = FMath::Max(TotalGripsPerRun / NumGrips, 1);
+
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				for (int32 i = 0; i < NumGrips; ++i)
 				{
-					bRootHasInterface = true;
+					ScalarResults[i] = RelativeTransforms[i] * AdditionTransforms[i] * ParentTransform;
 				}
-				if (actor->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
+			}
+			const double ScalarTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				Batch.ComposeWorldTransforms(ParentTransform);
+			}
+			const double BatchTime = FPlatformTime::Seconds() - StartTime;
+
+			bool bResultsMatch = true;
+			for (int32 i = 0; i < NumGrips; ++i)
+			{
+				bResultsMatch &= ScalarResults[i].Equals(Batch.WorldTransforms[i], KINDA_SMALL_NUMBER * 10.0f);
+			}
+
+			const double TotalGrips = (double)NumIterations * NumGrips;
+			UE_LOG(LogVRMotionController, Display, TEXT("Grip transform batch, %2d grips: per grip %.2fns, batched %.2fns (%.2fx), results match: %s"),
+				NumGrips,
+				(ScalarTime / TotalGrips) * 1.0e9,
+				(BatchTime / TotalGrips) * 1.0e9,
+				BatchTime > 0.0 ? ScalarTime / BatchTime : 0.0,
+				bResultsMatch ? TEXT("true") : TEXT("false"));
+		}
+	}
+
+	static FAutoConsoleCommand CmdBenchmarkGripTransformBatch(
+		TEXT("vr.BenchmarkGripTransformBatch"),
+		TEXT("Logs the cost of composing grip world transforms one at a time vs in a batch for 2, 8 and 32 grips.\n")
+		TEXT("Usage: vr.BenchmarkGripTransformBatch [TotalGripsPerRun=1000000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkGripTransformBatch));
+}
+
+void UGripMotionControllerComponent::GatherGripArray(TArray<FBPActorGripInformation> &GrippedObjectsArray, bool bReplicatedArray)
+{
+	// Only the stock default script with nothing else modifying it can be skipped
+	const bool bDefaultScriptIsStock = DefaultGripScript && DefaultGripScript->GetClass() == UGS_Default::StaticClass();
+
+	for (int i = GrippedObjectsArray.Num() - 1; i >= 0; --i)
+	{
+		if (!HasGripMovementAuthority(GrippedObjectsArray[i]))
+			continue;
+
+		FBPActorGripInformation * Grip = &GrippedObjectsArray[i];
+
+		
+		if (!Grip) // Shouldn't be possible, but why not play it safe
+			continue;
+
+		// Double checking here for a failed rep due to out of order replication from a spawned actor
+		if (!Grip->ValueCache.bWasInitiallyRepped && !HasGripAuthority(*Grip) && !HandleGripReplication(*Grip))
+			continue; // If we didn't successfully handle the replication (out of order) then continue on.
+
+		// Continue if the grip is paused
+		if (Grip->bIsPaused)
+			continue;
+
+		if (Grip->GripID != INVALID_VRGRIP_ID && Grip->GrippedObject && !Grip->GrippedObject->IsPendingKill())
+		{
+			UPrimitiveComponent *root = NULL;
+			AActor *actor = NULL;
+
+			// Getting the correct variables depending on the grip target type
+			switch (Grip->GripTargetType)
+			{
+				case EGripTargetType::ActorGrip:
+				//case EGripTargetType::InteractibleActorGrip:
 				{
-					// Actor grip interface is checked after component
-					bActorHasInterface = true;
-				}
+					actor = Grip->GetGrippedActor();
+					if(actor)
+						root = Cast<UPrimitiveComponent>(actor->GetRootComponent());
+				}break;
 
-				if (Grip->GripCollisionType == EGripCollisionType::CustomGrip)
+				case EGripTargetType::ComponentGrip:
+				//case EGripTargetType::InteractibleComponentGrip :
 				{
-					// Don't perform logic on the movement for this object, just pass in the GripTick() event with the controller difference instead
-					if(bRootHasInterface)
-						IVRGripInterface::Execute_TickGrip(root, this, *Grip, DeltaTime);
-					else if(bActorHasInterface)
-						IVRGripInterface::Execute_TickGrip(actor, this, *Grip, DeltaTime);
+					root = Grip->GetGrippedComponent();
+					if(root)
+						actor = root->GetOwner();
+				}break;
 
-					continue;
-				}
+			default:break;
+			}
 
-				bool bRescalePhysicsGrips = false;
-				
-				TArray<UVRGripScriptBase*> GripScripts;
+			// Last check to make sure the variables are valid
+			if (!root || !actor)
+				continue;
 
-				if (bRootHasInterface)
+			FGripTickEntry & Entry = GripTickBatch.AddEntry(Grip->RelativeTransform, Grip->AdditionTransform);
+			Entry.GripID = Grip->GripID;
+			Entry.bReplicatedArray = bReplicatedArray;
+			Entry.GrippedObject = Grip->GrippedObject;
+			Entry.Root = root;
+			Entry.Actor = actor;
+
+			// Interface implementations and scripts are cached at grip time, only re-resolve if the object or its root changed
+			// or one of the cached scripts was destroyed out from under us
+			FBPActorGripInformation::FGripValueCache & Cache = Grip->ValueCache;
+			if (!Cache.bInterfaceCacheValid || Cache.CachedInterfaceObject != Grip->GrippedObject || Cache.CachedInterfaceRoot != root || !Cache.AreCachedGripScriptsValid())
+				CacheGripInterfaceData(*Grip, root, actor);
+
+			Entry.bRootHasInterface = Cache.bCachedRootHasInterface;
+			Entry.bActorHasInterface = Cache.bCachedActorHasInterface;
+
+			// Don't perform logic on the movement for this object, it just gets the GripTick() event
+			Entry.bCustomGrip = Grip->GripCollisionType == EGripCollisionType::CustomGrip;
+			if (Entry.bCustomGrip)
+				continue;
+
+			bool bScriptModifiesTransform = false;
+			for (UVRGripScriptBase* Script : Cache.CachedGripScripts)
+			{
+				if (Script && Script->IsScriptActive() && Script->GetWorldTransformOverrideType() != EGSTransformOverrideType::None)
 				{
-					IVRGripInterface::Execute_GetGripScripts(root, GripScripts);
+					bScriptModifiesTransform = true;
+					break;
 				}
+			}
+
+			// The default script only adds to the base transform while secondary gripping or lerping out of it
+			const bool bInSecondaryGrip = (Grip->SecondaryGripInfo.bHasSecondaryAttachment && Grip->SecondaryGripInfo.SecondaryAttachment) || Grip->SecondaryGripInfo.GripLerpState == EGripLerpState::EndLerp;
+
+			Entry.bUseComposedTransform = bDefaultScriptIsStock && !bScriptModifiesTransform && !bInSecondaryGrip;
+		}
+		else
+		{
+			// Object has been destroyed without notification to plugin
+			CleanUpBadGrip(GrippedObjectsArray, i, bReplicatedArray);
+		}
+	}
+}
+
+void UGripMotionControllerComponent::ProcessGripBatch(const FTransform & ParentTransform, float DeltaTime)
+{
+	FTransform WorldTransform;
+
+	for (int32 EntryIndex = 0; EntryIndex < GripTickBatch.Entries.Num(); ++EntryIndex)
+	{
+		FGripTickEntry & Entry = GripTickBatch.Entries[EntryIndex];
+		TArray<FBPActorGripInformation> & GrippedObjectsArray = Entry.bReplicatedArray ? GrippedObjects : LocallyGrippedObjects;
+
+		// Looking it back up by ID, an earlier grip in the batch may have dropped this one or shifted the array
+		FBPActorGripInformation * Grip = GrippedObjectsArray.FindByKey(Entry.GripID);
+
+		if (!Grip || Grip->GrippedObject != Entry.GrippedObject || !Grip->GrippedObject || Grip->GrippedObject->IsPendingKill())
+			continue;
+
+		UPrimitiveComponent *root = Entry.Root;
+		AActor *actor = Entry.Actor;
+		const bool bRootHasInterface = Entry.bRootHasInterface;
+		const bool bActorHasInterface = Entry.bActorHasInterface;
+		TArray<UVRGripScriptBase*> & GripScripts = Grip->ValueCache.CachedGripScripts;
+
+		if (Entry.bCustomGrip)
+		{
+			// Don't perform logic on the movement for this object, just pass in the GripTick() event with the controller difference instead
+			if(bRootHasInterface)
+				IVRGripInterface::Execute_TickGrip(root, this, *Grip, DeltaTime);
+			else if(bActorHasInterface)
+				IVRGripInterface::Execute_TickGrip(actor, this, *Grip, DeltaTime);
+
+			continue;
+		}
+
+		bool bRescalePhysicsGrips = false;
+		bool bForceADrop = false;
+
+		bool bHasValidWorldTransform = true;
+
+		if (Entry.bUseComposedTransform)
+		{
+			// Nothing would change the default transform, skip the script calls
+			// Still honor ForceGripToDrop on the default script, GetGripWorldTransform would have read it
+			WorldTransform = GripTickBatch.WorldTransforms[EntryIndex];
+			bForceADrop = DefaultGripScript && DefaultGripScript->Wants_ToForceDrop();
+		}
+		else
+		{
+			// Get the world transform for this grip after handling secondary grips and interaction differences
+			bHasValidWorldTransform = GetGripWorldTransform(GripScripts, DeltaTime, WorldTransform, ParentTransform, *Grip, actor, root, bRootHasInterface, bActorHasInterface, false, bForceADrop);
+		}
+
+		// If a script or behavior is telling us to skip this and continue on (IE: it dropped the grip)
+		if (bForceADrop)
+		{
+			if (HasGripAuthority(*Grip))
+			{
+				if (bRootHasInterface)
+					DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(root));
 				else if (bActorHasInterface)
-				{
-					IVRGripInterface::Execute_GetGripScripts(actor, GripScripts);
-				}
+					DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(actor));
+				else
+					DropGrip(*Grip, true);
+			}
 
+			continue;
+		}
+		else if (!bHasValidWorldTransform)
+		{
+			continue;
+		}
 
-				bool bForceADrop = false;
+		if (!root->GetComponentScale().Equals(WorldTransform.GetScale3D()))
+			bRescalePhysicsGrips = true;
 
-				// Get the world transform for this grip after handling secondary grips and interaction differences
-				bool bHasValidWorldTransform = GetGripWorldTransform(GripScripts, DeltaTime, WorldTransform, ParentTransform, *Grip, actor, root, bRootHasInterface, bActorHasInterface, false, bForceADrop);
+		// If we just teleported, skip this update and just teleport forward
+		if (bIsPostTeleport)
+		{
+			TeleportMoveGrip_Impl(*Grip, true, true, WorldTransform);
+			continue;
+		}
 
-				// If a script or behavior is telling us to skip this and continue on (IE: it dropped the grip)
-				if (bForceADrop)
-				{
-					if (HasGripAuthority(*Grip))
-					{
-						if (bRootHasInterface)
-							DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(root));
-						else if (bActorHasInterface)
-							DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(actor));
-						else
-							DropGrip(*Grip, true);
-					}
+		// Auto drop based on distance from expected point
+		// Not perfect, should be done post physics or in next frame prior to changing controller location
+		// However I don't want to recalculate world transform
+		// Maybe add a grip variable of "expected loc" and use that to check next frame, but for now this will do.
+		if ((bRootHasInterface || bActorHasInterface) &&
+			(
+					(Grip->GripCollisionType != EGripCollisionType::AttachmentGrip) &&
+					(Grip->GripCollisionType != EGripCollisionType::PhysicsOnly) && 
+					(Grip->GripCollisionType != EGripCollisionType::SweepWithPhysics)) &&
+					((Grip->GripCollisionType != EGripCollisionType::InteractiveHybridCollisionWithSweep) || ((Grip->GripCollisionType == EGripCollisionType::InteractiveHybridCollisionWithSweep) && Grip->bColliding))
+			)
+		{
 
-					continue;
+			// After initial teleportation the constraint local pose can be not updated yet, so lets delay a frame to let it update
+			// Otherwise may cause unintended auto drops
+			if (Grip->bSkipNextConstraintLengthCheck)
+			{
+				Grip->bSkipNextConstraintLengthCheck = false;
+			}
+			else
+			{
+				float BreakDistance = 0.0f;
+				if (bRootHasInterface)
+				{
+					BreakDistance = IVRGripInterface::Execute_GripBreakDistance(root);
 				}
-				else if (!bHasValidWorldTransform)
+				else if (bActorHasInterface)
 				{
-					continue;
+					// Actor grip interface is checked after component
+					BreakDistance = IVRGripInterface::Execute_GripBreakDistance(actor);
 				}
 
-				if (!root->GetComponentScale().Equals(WorldTransform.GetScale3D()))
-					bRescalePhysicsGrips = true;
-
-				// If we just teleported, skip this update and just teleport forward
-				if (bIsPostTeleport)
+				FVector CheckDistance;
+				if (!GetPhysicsJointLength(*Grip, root, CheckDistance))
 				{
-					TeleportMoveGrip_Impl(*Grip, true, true, WorldTransform);
-					continue;
+					CheckDistance = (WorldTransform.GetLocation() - root->GetComponentLocation());
 				}
 
-				// Auto drop based on distance from expected point
-				// Not perfect, should be done post physics or in next frame prior to changing controller location
-				// However I don't want to recalculate world transform
-				// Maybe add a grip variable of "expected loc" and use that to check next frame, but for now this will do.
-				if ((bRootHasInterface || bActorHasInterface) &&
-					(
-							(Grip->GripCollisionType != EGripCollisionType::AttachmentGrip) &&
-							(Grip->GripCollisionType != EGripCollisionType::PhysicsOnly) && 
-							(Grip->GripCollisionType != EGripCollisionType::SweepWithPhysics)) &&
-							((Grip->GripCollisionType != EGripCollisionType::InteractiveHybridCollisionWithSweep) || ((Grip->GripCollisionType == EGripCollisionType::InteractiveHybridCollisionWithSweep) && Grip->bColliding))
-					)
-				{
+				// Set grip distance now for people to use
+				Grip->GripDistance = CheckDistance.Size();
 
-					// After initial teleportation the constraint local pose can be not updated yet, so lets delay a frame to let it update
-					// Otherwise may cause unintended auto drops
-					if (Grip->bSkipNextConstraintLengthCheck)
-					{
-						Grip->bSkipNextConstraintLengthCheck = false;
-					}
-					else
+				if (BreakDistance > 0.0f)
+				{
+					if (Grip->GripDistance >= BreakDistance)
 					{
-						float BreakDistance = 0.0f;
-						if (bRootHasInterface)
-						{
-							BreakDistance = IVRGripInterface::Execute_GripBreakDistance(root);
-						}
-						else if (bActorHasInterface)
+						bool bIgnoreDrop = false;
+						for (UVRGripScriptBase* Script : GripScripts)
 						{
-							// Actor grip interface is checked after component
-							BreakDistance = IVRGripInterface::Execute_GripBreakDistance(actor);
+							if (Script && Script->IsScriptActive() && Script->Wants_DenyAutoDrop())
+							{
+								bIgnoreDrop = true;
+								break;
+							}
 						}
 
-						FVector CheckDistance;
-						if (!GetPhysicsJointLength(*Grip, root, CheckDistance))
+						if (bIgnoreDrop)
 						{
-							CheckDistance = (WorldTransform.GetLocation() - root->GetComponentLocation());
+							// Script canceled this out
 						}
-
-						// Set grip distance now for people to use
-						Grip->GripDistance = CheckDistance.Size();
-
-						if (BreakDistance > 0.0f)
+						else if (OnGripOutOfRange.IsBound())
 						{
-							if (Grip->GripDistance >= BreakDistance)
+							uint8 GripID = Grip->GripID;
+							OnGripOutOfRange.Broadcast(*Grip, Grip->GripDistance);
+
+							// Check if we still have the grip or not
+							FBPActorGripInformation GripInfo;
+							EBPVRResultSwitch Result;
+							GetGripByID(GripInfo, GripID, Result);
+							if (Result == EBPVRResultSwitch::OnFailed)
 							{
-								bool bIgnoreDrop = false;
-								for (UVRGripScriptBase* Script : GripScripts)
-								{
-									if (Script && Script->IsScriptActive() && Script->Wants_DenyAutoDrop())
-									{
-										bIgnoreDrop = true;
-										break;
-									}
-								}
-
-								if (bIgnoreDrop)
-								{
-									// Script canceled this out
-								}
-								else if (OnGripOutOfRange.IsBound())
-								{
-									uint8 GripID = Grip->GripID;
-									OnGripOutOfRange.Broadcast(*Grip, Grip->GripDistance);
-
-									// Check if we still have the grip or not
-									FBPActorGripInformation GripInfo;
-									EBPVRResultSwitch Result;
-									GetGripByID(GripInfo, GripID, Result);
-									if (Result == EBPVRResultSwitch::OnFailed)
-									{
-										// Don't bother moving it, it is dropped now
-										continue;
-									}
-								}
-								else if(HasGripAuthority(*Grip))
-								{
-									if(bRootHasInterface)
-										DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(root));
-									else
-										DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(actor));
-
-									// Don't bother moving it, it is dropped now
-									continue;
-								}
+								// Don't bother moving it, it is dropped now
+								continue;
 							}
 						}
+						else if(HasGripAuthority(*Grip))
+						{
+							if(bRootHasInterface)
+								DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(root));
+							else
+								DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(actor));
+
+							// Don't bother moving it, it is dropped now
+							continue;
+						}
 					}
 				}
+			}
+		}
 
-				// Start handling the grip types and their functions
-				switch (Grip->GripCollisionType)
+		// Start handling the grip types and their functions
+		switch (Grip->GripCollisionType)
+		{
+			case EGripCollisionType::InteractiveCollisionWithPhysics:
+			{
+				UpdatePhysicsHandleTransform(*Grip, WorldTransform);
+				
+				if(bRescalePhysicsGrips)
+					root->SetWorldScale3D(WorldTransform.GetScale3D());
+
+				// Sweep current collision state, only used for client side late update removal
+				if (
+					(bHasAuthority &&
+						((Grip->GripLateUpdateSetting == EGripLateUpdateSettings::NotWhenColliding) ||
+							(Grip->GripLateUpdateSetting == EGripLateUpdateSettings::NotWhenCollidingOrDoubleGripping)))
+					)
 				{
-					case EGripCollisionType::InteractiveCollisionWithPhysics:
+					//TArray<FOverlapResult> Hits;
+					FComponentQueryParams Params(NAME_None, this->GetOwner());
+					Params.bTraceAsyncScene = root->bCheckAsyncSceneOnMove;
+					Params.AddIgnoredActor(actor);
+					Params.AddIgnoredActors(root->MoveIgnoreActors);
+
+					TArray<FHitResult> Hits;
+					
+					// Switched over to component sweep because it picks up on pivot offsets without me manually calculating it
+					FVector SweepStart = root->GetComponentLocation();
+					FVector SweepEnd = WorldTransform.GetLocation();
+					if (SweepGripComponent(Hits, root, SweepStart, SweepEnd, WorldTransform.GetRotation(), Params))
 					{
-						UpdatePhysicsHandleTransform(*Grip, WorldTransform);
-						
-						if(bRescalePhysicsGrips)
-							root->SetWorldScale3D(WorldTransform.GetScale3D());
+						Grip->bColliding = true;
+					}
+					else
+					{
+						Grip->bColliding = false;
+					}
+				}
 
-						// Sweep current collision state, only used for client side late update removal
-						if (
-							(bHasAuthority &&
-								((Grip->GripLateUpdateSetting == EGripLateUpdateSettings::NotWhenColliding) ||
-									(Grip->GripLateUpdateSetting == EGripLateUpdateSettings::NotWhenCollidingOrDoubleGripping)))
-							)
-						{
-							//TArray<FOverlapResult> Hits;
-							FComponentQueryParams Params(NAME_None, this->GetOwner());
-							Params.bTraceAsyncScene = root->bCheckAsyncSceneOnMove;
-							Params.AddIgnoredActor(actor);
-							Params.AddIgnoredActors(root->MoveIgnoreActors);
+			}break;
 
-							TArray<FHitResult> Hits;
-							
-							// Switched over to component sweep because it picks up on pivot offsets without me manually calculating it
-							if (GetWorld()->ComponentSweepMulti(Hits, root, root->GetComponentLocation(), WorldTransform.GetLocation(), WorldTransform.GetRotation(), Params))
-							{
-								Grip->bColliding = true;
-							}
-							else
-							{
-								Grip->bColliding = false;
-							}
-						}
+			case EGripCollisionType::InteractiveCollisionWithSweep:
+			{
+				FVector OriginalPosition(root->GetComponentLocation());
+				FVector NewPosition(WorldTransform.GetTranslation());
+
+				if (!Grip->bIsLocked)
+					root->ComponentVelocity = (NewPosition - OriginalPosition) / DeltaTime;
+
+				if (Grip->bIsLocked)
+					WorldTransform.SetRotation(Grip->LastLockedRotation);
 
-					}break;
+				FHitResult OutHit;
+				// Need to use without teleport so that the physics velocity is updated for when the actor is released to throw
+
+				root->SetWorldTransform(WorldTransform, true, &OutHit);
+
+				if (OutHit.bBlockingHit)
+				{
+					Grip->bColliding = true;
 
-					case EGripCollisionType::InteractiveCollisionWithSweep:
+					if (!Grip->bIsLocked)
 					{
-						FVector OriginalPosition(root->GetComponentLocation());
-						FVector NewPosition(WorldTransform.GetTranslation());
+						Grip->bIsLocked = true;
+						Grip->LastLockedRotation = root->GetComponentQuat();
+					}
+				}
+				else
+				{
+					Grip->bColliding = false;
 
-						if (!Grip->bIsLocked)
-							root->ComponentVelocity = (NewPosition - OriginalPosition) / DeltaTime;
+					if (Grip->bIsLocked)
+						Grip->bIsLocked = false;
+				}
+			}break;
+
+			case EGripCollisionType::InteractiveHybridCollisionWithPhysics:
+			{
+				UpdatePhysicsHandleTransform(*Grip, WorldTransform);
+
+				if (bRescalePhysicsGrips)
+					root->SetWorldScale3D(WorldTransform.GetScale3D());
+
+				// Always Sweep current collision state with this, used for constraint strength
+				//TArray<FOverlapResult> Hits;
+				FComponentQueryParams Params(NAME_None, this->GetOwner());
+				Params.bTraceAsyncScene = root->bCheckAsyncSceneOnMove;
+				Params.AddIgnoredActor(actor);
+				Params.AddIgnoredActors(root->MoveIgnoreActors);
+
+				TArray<FHitResult> Hits;
+				// Checking both current and next position for overlap using this grip type
+				// Switched over to component sweep because it picks up on pivot offsets without me manually calculating it
+				FVector SweepStart = root->GetComponentLocation();
+				FVector SweepEnd = WorldTransform.GetLocation();
+				if (SweepGripComponent(Hits, root, SweepStart, SweepEnd, WorldTransform.GetRotation(), Params))
+				{
+					if (!Grip->bColliding)
+					{
+						SetGripConstraintStiffnessAndDamping(Grip, false);
+					}
+					Grip->bColliding = true;
+				}
+				else
+				{
+					if (Grip->bColliding)
+					{
+						SetGripConstraintStiffnessAndDamping(Grip, true);
+					}
 
-						if (Grip->bIsLocked)
-							WorldTransform.SetRotation(Grip->LastLockedRotation);
+					Grip->bColliding = false;
+				}
 
-						FHitResult OutHit;
-						// Need to use without teleport so that the physics velocity is updated for when the actor is released to throw
+			}break;
 
-						root->SetWorldTransform(WorldTransform, true, &OutHit);
+			case EGripCollisionType::InteractiveHybridCollisionWithSweep:
+			{
 
-						if (OutHit.bBlockingHit)
-						{
-							Grip->bColliding = true;
+				// Make sure that there is no collision on course before turning off collision and snapping to controller
+				FBPActorPhysicsHandleInformation * GripHandle = GetPhysicsGrip(*Grip);
 
-							if (!Grip->bIsLocked)
-							{
-								Grip->bIsLocked = true;
-								Grip->LastLockedRotation = root->GetComponentQuat();
-							}
-						}
-						else
-						{
-							Grip->bColliding = false;
+				TArray<FHitResult> Hits;
+				FComponentQueryParams Params(NAME_None, this->GetOwner());
+				Params.bTraceAsyncScene = root->bCheckAsyncSceneOnMove;
+				Params.AddIgnoredActor(actor);
+				Params.AddIgnoredActors(root->MoveIgnoreActors);
 
-							if (Grip->bIsLocked)
-								Grip->bIsLocked = false;
-						}
-					}break;
+				FVector SweepStart = root->GetComponentLocation();
+				FVector SweepEnd = WorldTransform.GetLocation();
+				if (SweepGripComponent(Hits, root, SweepStart, SweepEnd, WorldTransform.GetRotation(), Params))
+				{
+					Grip->bColliding = true;
+				}
+				else
+				{
+					Grip->bColliding = false;
+				}
 
-					case EGripCollisionType::InteractiveHybridCollisionWithPhysics:
+				if (!Grip->bColliding)
+				{
+					if (GripHandle)
 					{
-						UpdatePhysicsHandleTransform(*Grip, WorldTransform);
-
-						if (bRescalePhysicsGrips)
-							root->SetWorldScale3D(WorldTransform.GetScale3D());
+						DestroyPhysicsHandle(*Grip);
 
-						// Always Sweep current collision state with this, used for constraint strength
-						//TArray<FOverlapResult> Hits;
-						FComponentQueryParams Params(NAME_None, this->GetOwner());
-						Params.bTraceAsyncScene = root->bCheckAsyncSceneOnMove;
-						Params.AddIgnoredActor(actor);
-						Params.AddIgnoredActors(root->MoveIgnoreActors);
-
-						TArray<FHitResult> Hits;
-						// Checking both current and next position for overlap using this grip type
-						// Switched over to component sweep because it picks up on pivot offsets without me manually calculating it
-						if (GetWorld()->ComponentSweepMulti(Hits, root, root->GetComponentLocation(), WorldTransform.GetLocation(), WorldTransform.GetRotation(), Params))
+						switch (Grip->GripTargetType)
 						{
-							if (!Grip->bColliding)
-							{
-								SetGripConstraintStiffnessAndDamping(Grip, false);
-							}
-							Grip->bColliding = true;
-						}
-						else
+						case EGripTargetType::ComponentGrip:
 						{
-							if (Grip->bColliding)
-							{
-								SetGripConstraintStiffnessAndDamping(Grip, true);
-							}
-
-							Grip->bColliding = false;
+							root->SetSimulatePhysics(false);
+						}break;
+						case EGripTargetType::ActorGrip:
+						{
+							actor->DisableComponentsSimulatePhysics();
+						} break;
 						}
+					}
 
-					}break;
+					root->SetWorldTransform(WorldTransform, false);// , &OutHit);
 
-					case EGripCollisionType::InteractiveHybridCollisionWithSweep:
+				}
+				else if (Grip->bColliding && !GripHandle)
+				{
+					root->SetSimulatePhysics(true);
+
+					SetUpPhysicsHandle(*Grip);
+					UpdatePhysicsHandleTransform(*Grip, WorldTransform);
+					if (bRescalePhysicsGrips)
+						root->SetWorldScale3D(WorldTransform.GetScale3D());
+				}
+				else
+				{
+					// Shouldn't be a grip handle if not server when server side moving
+					if (GripHandle)
 					{
+						UpdatePhysicsHandleTransform(*Grip, WorldTransform);
+						if (bRescalePhysicsGrips)
+							root->SetWorldScale3D(WorldTransform.GetScale3D());
+					}
+				}
 
-						// Make sure that there is no collision on course before turning off collision and snapping to controller
-						FBPActorPhysicsHandleInformation * GripHandle = GetPhysicsGrip(*Grip);
+			}break;
 
-						TArray<FHitResult> Hits;
-						FComponentQueryParams Params(NAME_None, this->GetOwner());
-						Params.bTraceAsyncScene = root->bCheckAsyncSceneOnMove;
-						Params.AddIgnoredActor(actor);
-						Params.AddIgnoredActors(root->MoveIgnoreActors);
+			case EGripCollisionType::SweepWithPhysics:
+			{
+				FVector OriginalPosition(root->GetComponentLocation());
+				FRotator OriginalOrientation(root->GetComponentRotation());
 
-						if (GetWorld()->ComponentSweepMulti(Hits, root, root->GetComponentLocation(), WorldTransform.GetLocation(), WorldTransform.GetRotation(), Params))
-						{
-							Grip->bColliding = true;
-						}
-						else
-						{
-							Grip->bColliding = false;
-						}
+				FVector NewPosition(WorldTransform.GetTranslation());
+				FRotator NewOrientation(WorldTransform.GetRotation());
 
-						if (!Grip->bColliding)
-						{
-							if (GripHandle)
-							{
-								DestroyPhysicsHandle(*Grip);
-
-								switch (Grip->GripTargetType)
-								{
-								case EGripTargetType::ComponentGrip:
-								{
-									root->SetSimulatePhysics(false);
-								}break;
-								case EGripTargetType::ActorGrip:
-								{
-									actor->DisableComponentsSimulatePhysics();
-								} break;
-								}
-							}
+				root->ComponentVelocity = (NewPosition - OriginalPosition) / DeltaTime;
 
-							root->SetWorldTransform(WorldTransform, false);// , &OutHit);
+				// Now sweep collision separately so we can get hits but not have the location altered
+				if (bUseWithoutTracking || NewPosition != OriginalPosition || NewOrientation != OriginalOrientation)
+				{
+					FVector move = NewPosition - OriginalPosition;
 
-						}
-						else if (Grip->bColliding && !GripHandle)
-						{
-							root->SetSimulatePhysics(true);
+					// ComponentSweepMulti does nothing if moving < KINDA_SMALL_NUMBER in distance, so it's important to not try to sweep distances smaller than that. 
+					const float MinMovementDistSq = (FMath::Square(4.f*KINDA_SMALL_NUMBER));
 
-							SetUpPhysicsHandle(*Grip);
-							UpdatePhysicsHandleTransform(*Grip, WorldTransform);
-							if (bRescalePhysicsGrips)
-								root->SetWorldScale3D(WorldTransform.GetScale3D());
+					if (bUseWithoutTracking || move.SizeSquared() > MinMovementDistSq || NewOrientation != OriginalOrientation)
+					{
+						if (CheckComponentWithSweep(root, move, OriginalOrientation, false))
+						{
+							Grip->bColliding = true;
 						}
 						else
 						{
-							// Shouldn't be a grip handle if not server when server side moving
-							if (GripHandle)
-							{
-								UpdatePhysicsHandleTransform(*Grip, WorldTransform);
-								if (bRescalePhysicsGrips)
-									root->SetWorldScale3D(WorldTransform.GetScale3D());
-							}
+							Grip->bColliding = false;
 						}
 
-					}break;
-
-					case EGripCollisionType::SweepWithPhysics:
-					{
-						FVector OriginalPosition(root->GetComponentLocation());
-						FRotator OriginalOrientation(root->GetComponentRotation());
-
-						FVector NewPosition(WorldTransform.GetTranslation());
-						FRotator NewOrientation(WorldTransform.GetRotation());
-
-						root->ComponentVelocity = (NewPosition - OriginalPosition) / DeltaTime;
-
-						// Now sweep collision separately so we can get hits but not have the location altered
-						if (bUseWithoutTracking || NewPosition != OriginalPosition || NewOrientation != OriginalOrientation)
+						TArray<USceneComponent* > PrimChildren;
+						root->GetChildrenComponents(true, PrimChildren);
+						for (USceneComponent * Prim : PrimChildren)
 						{
-							FVector move = NewPosition - OriginalPosition;
-
-							// ComponentSweepMulti does nothing if moving < KINDA_SMALL_NUMBER in distance, so it's important to not try to sweep distances smaller than that. 
-							const float MinMovementDistSq = (FMath::Square(4.f*KINDA_SMALL_NUMBER));
-
-							if (bUseWithoutTracking || move.SizeSquared() > MinMovementDistSq || NewOrientation != OriginalOrientation)
+							if (UPrimitiveComponent * primComp = Cast<UPrimitiveComponent>(Prim))
 							{
-								if (CheckComponentWithSweep(root, move, OriginalOrientation, false))
-								{
-									Grip->bColliding = true;
-								}
-								else
-								{
-									Grip->bColliding = false;
-								}
-
-								TArray<USceneComponent* > PrimChildren;
-								root->GetChildrenComponents(true, PrimChildren);
-								for (USceneComponent * Prim : PrimChildren)
-								{
-									if (UPrimitiveComponent * primComp = Cast<UPrimitiveComponent>(Prim))
-									{
-										CheckComponentWithSweep(primComp, move, primComp->GetComponentRotation(), false);
-									}
-								}
+								CheckComponentWithSweep(primComp, move, primComp->GetComponentRotation(), false);
 							}
 						}
+					}
+				}
 
-						// Move the actor, we are not offsetting by the hit result anyway
-						root->SetWorldTransform(WorldTransform, false);
-
-					}break;
+				// Move the actor, we are not offsetting by the hit result anyway
+				root->SetWorldTransform(WorldTransform, false);
 
-					case EGripCollisionType::PhysicsOnly:
-					{
-						// Move the actor, we are not offsetting by the hit result anyway
-						root->SetWorldTransform(WorldTransform, false);
-					}break;
+			}break;
 
-					case EGripCollisionType::AttachmentGrip:
-					{
-						FTransform RelativeTrans = WorldTransform.GetRelativeTransform(ParentTransform);
-						if (!root->GetRelativeTransform().Equals(RelativeTrans))
-						{
-							root->SetRelativeTransform(RelativeTrans);
-						}
+			case EGripCollisionType::PhysicsOnly:
+			{
+				// Move the actor, we are not offsetting by the hit result anyway
+				root->SetWorldTransform(WorldTransform, false);
+			}break;
 
-					}break;
+			case EGripCollisionType::AttachmentGrip:
+			{
+				FTransform RelativeTrans = WorldTransform.GetRelativeTransform(ParentTransform);
+				if (!root->GetRelativeTransform().Equals(RelativeTrans))
+				{
+					root->SetRelativeTransform(RelativeTrans);
+				}
 
-					case EGripCollisionType::ManipulationGrip:
-					case EGripCollisionType::ManipulationGripWithWristTwist:
-					{
-						UpdatePhysicsHandleTransform(*Grip, WorldTransform);
-						if (bRescalePhysicsGrips)
-							root->SetWorldScale3D(WorldTransform.GetScale3D());
-					}break;
+			}break;
 
-					default:
-					{}break;
-				}
+			case EGripCollisionType::ManipulationGrip:
+			case EGripCollisionType::ManipulationGripWithWristTwist:
+			{
+				UpdatePhysicsHandleTransform(*Grip, WorldTransform);
+				if (bRescalePhysicsGrips)
+					root->SetWorldScale3D(WorldTransform.GetScale3D());
+			}break;
 
-				// We only do this if specifically requested, it has a slight perf hit and isn't normally needed for non Custom Grip types
-				if (bAlwaysSendTickGrip)
-				{
-					// All non custom grips tick after translation, this is still pre physics so interactive grips location will be wrong, but others will be correct
-					if (bRootHasInterface)
-					{
-						IVRGripInterface::Execute_TickGrip(root, this, *Grip, DeltaTime);
-					}
+			default:
+			{}break;
+		}
 
-					if (bActorHasInterface)
-					{
-						IVRGripInterface::Execute_TickGrip(actor, this, *Grip, DeltaTime);
-					}
-				}
+		// We only do this if specifically requested, it has a slight perf hit and isn't normally needed for non Custom Grip types
+		if (bAlwaysSendTickGrip)
+		{
+			// All non custom grips tick after translation, this is still pre physics so interactive grips location will be wrong, but others will be correct
+			if (bRootHasInterface)
+			{
+				IVRGripInterface::Execute_TickGrip(root, this, *Grip, DeltaTime);
 			}
-			else
+
+			if (bActorHasInterface)
 			{
-				// Object has been destroyed without notification to plugin
-				CleanUpBadGrip(GrippedObjectsArray, i, bReplicatedArray);
+				IVRGripInterface::Execute_TickGrip(actor, this, *Grip, DeltaTime);
 			}
 		}
 	}
+
+	GripTickBatch.Reset();
 }
 
 
@@ -3861,6 +4211,105 @@ void UGripMotionControllerComponent::CleanUpBadPhysicsHandles()
 	}
 }
 
+#if WITH_PHYSX
+// Released physics grip handles are parked here per scene and handed back out on the next grab
+// Saves creating / inserting a new kinematic actor and joint every time something is picked up
+namespace GripPhysicsHandlePool
+{
+	struct FPooledHandle
+	{
+		PxD6Joint * Joint;
+		PxRigidDynamic * KinActor;
+	};
+
+	struct FScenePool
+	{
+		TWeakObjectPtr<UWorld> World;
+		TArray<FPooledHandle> Handles;
+	};
+
+	static TMap<PxScene*, FScenePool> ScenePools;
+	static FDelegateHandle WorldCleanupHandle;
+
+	static void OnWorldCleanup(UWorld * World, bool bSessionEnded, bool bCleanupResources)
+	{
+		for (auto It = ScenePools.CreateIterator(); It; ++It)
+		{
+			FScenePool & Pool = It.Value();
+			if (Pool.World.IsValid() && Pool.World.Get() != World)
+				continue;
+
+			// Scene is still alive at this point, it gets torn down after world cleanup
+			// A pool without a world lost its scene already, just forget about it
+			if (Pool.World.IsValid())
+			{
+				SCOPED_SCENE_WRITE_LOCK(It.Key());
+				for (FPooledHandle & Handle : Pool.Handles)
+				{
+					Handle.Joint->release();
+					Handle.KinActor->release();
+				}
+			}
+
+			DEC_DWORD_STAT_BY(STAT_PhysicsGripHandlesPooled, Pool.Handles.Num());
+			It.RemoveCurrent();
+		}
+	}
+
+	// Expects the scene to already be write locked
+	static bool Release(UWorld * World, PxScene * Scene, PxD6Joint * Joint, PxRigidDynamic * KinActor)
+	{
+		if (!World || World->bIsTearingDown || (Joint->getConstraintFlags() & PxConstraintFlag::eBROKEN))
+			return false;
+
+		FScenePool & Pool = ScenePools.FindOrAdd(Scene);
+		if (Pool.Handles.Num() >= GripMotionControllerCvars::PhysicsGripPoolSize)
+			return false;
+
+		if (!WorldCleanupHandle.IsValid())
+			WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnWorldCleanup);
+
+		Pool.World = World;
+
+		// Let go of the held body and relax the drives so that the parked joint does nothing
+		Joint->setActors(KinActor, NULL);
+		for (int32 DriveIndex = 0; DriveIndex < PxD6Drive::eCOUNT; ++DriveIndex)
+		{
+			Joint->setDrive((PxD6Drive::Enum)DriveIndex, PxD6JointDrive());
+		}
+
+		FPooledHandle & Handle = Pool.Handles[Pool.Handles.AddUninitialized()];
+		Handle.Joint = Joint;
+		Handle.KinActor = KinActor;
+		INC_DWORD_STAT(STAT_PhysicsGripHandlesPooled);
+		return true;
+	}
+
+	// Expects the scene to already be write locked, joint frames are reset to what a freshly created one would have
+	static bool Acquire(PxScene * Scene, const PxTransform & KinPose, PxRigidDynamic * PActor, PxD6Joint *& OutJoint, PxRigidDynamic *& OutKinActor)
+	{
+		FScenePool * Pool = ScenePools.Find(Scene);
+
+		if (!Pool || !Pool->Handles.Num())
+			return false;
+
+		FPooledHandle Handle = Pool->Handles.Pop(false);
+		DEC_DWORD_STAT(STAT_PhysicsGripHandlesPooled);
+
+		Handle.KinActor->setGlobalPose(KinPose);
+		Handle.Joint->setActors(Handle.KinActor, PActor);
+		Handle.Joint->setLocalPose(PxJointActorIndex::eACTOR0, PxTransform(PxIdentity));
+		Handle.Joint->setLocalPose(PxJointActorIndex::eACTOR1, PActor->getGlobalPose().transformInv(KinPose));
+		Handle.Joint->setDrivePosition(PxTransform(PxIdentity));
+		Handle.Joint->setDriveVelocity(PxVec3(0.0f), PxVec3(0.0f));
+
+		OutJoint = Handle.Joint;
+		OutKinActor = Handle.KinActor;
+		return true;
+	}
+}
+#endif // WITH_PHYSX
+
 bool UGripMotionControllerComponent::DestroyPhysicsHandle(/*int32 SceneIndex,*/ physx::PxD6Joint** HandleData, physx::PxRigidDynamic** KinActorData)
 {
 	#if WITH_PHYSX
@@ -3874,12 +4323,18 @@ bool UGripMotionControllerComponent::DestroyPhysicsHandle(/*int32 SceneIndex,*/
 			{
 				SCOPED_SCENE_WRITE_LOCK(PScene);
 
-				// Destroy joint.
-				(*HandleData)->release();
+				// Park them for the next grip if there is room, otherwise destroy them
+				if (!GripPhysicsHandlePool::Release(GetWorld(), PScene, *HandleData, *KinActorData))
+				{
+					// Destroy joint.
+					(*HandleData)->release();
 
-				// Destroy temporary actor.
-				(*KinActorData)->release();
+					// Destroy temporary actor.
+					(*KinActorData)->release();
+				}
 			}
+
+			DEC_DWORD_STAT(STAT_PhysicsGripHandlesActive);
 			*KinActorData = NULL;
 			*HandleData = NULL;
 		}
@@ -4039,26 +4494,32 @@ bool UGripMotionControllerComponent::SetUpPhysicsHandle(const FBPActorGripInform
 			// If we don't already have a handle - make one now.
 			if (!HandleInfo->HandleData)
 			{
-				// Create kinematic actor we are going to create joint with. This will be moved around with calls to SetLocation/SetRotation.
-				PxRigidDynamic* KinActor = Scene->getPhysics().createRigidDynamic(KinPose);
-				KinActor->setRigidBodyFlag(PxRigidBodyFlag::eKINEMATIC, true);
+				PxRigidDynamic* KinActor = NULL;
+				PxD6Joint* NewJoint = NULL;
+
+				// Re-use a released kinematic actor and joint from this scene if there is one
+				if (!GripPhysicsHandlePool::Acquire(Scene, KinPose, PActor, NewJoint, KinActor))
+				{
+					// Create kinematic actor we are going to create joint with. This will be moved around with calls to SetLocation/SetRotation.
+					KinActor = Scene->getPhysics().createRigidDynamic(KinPose);
+					KinActor->setRigidBodyFlag(PxRigidBodyFlag::eKINEMATIC, true);
 
-				KinActor->setMass(0.0f); // 1.0f;
-				KinActor->setMassSpaceInertiaTensor(PxVec3(0.0f, 0.0f, 0.0f));// PxVec3(1.0f, 1.0f, 1.0f));
-				KinActor->setMaxDepenetrationVelocity(PX_MAX_F32);
+					KinActor->setMass(0.0f); // 1.0f;
+					KinActor->setMassSpaceInertiaTensor(PxVec3(0.0f, 0.0f, 0.0f));// PxVec3(1.0f, 1.0f, 1.0f));
+					KinActor->setMaxDepenetrationVelocity(PX_MAX_F32);
 
-				// No bodyinstance
-				KinActor->userData = NULL;
+					// No bodyinstance
+					KinActor->userData = NULL;
 
-				// Add to Scene
-				Scene->addActor(*KinActor);
+					// Add to Scene
+					Scene->addActor(*KinActor);
+
+					// Create the joint
+					NewJoint = PxD6JointCreate(Scene->getPhysics(), KinActor, PxTransform(PxIdentity), PActor, PActor->getGlobalPose().transformInv(KinPose));
+				}
 
 				// Save reference to the kinematic actor.
 				HandleInfo->KinActorData = KinActor;
-				PxD6Joint* NewJoint = NULL;
-
-				// Create the joint
-				NewJoint = PxD6JointCreate(Scene->getPhysics(), KinActor, PxTransform(PxIdentity), PActor, PActor->getGlobalPose().transformInv(KinPose));
 
 				if (!NewJoint)
 				{
@@ -4066,6 +4527,8 @@ bool UGripMotionControllerComponent::SetUpPhysicsHandle(const FBPActorGripInform
 				}
 				else
 				{
+					INC_DWORD_STAT(STAT_PhysicsGripHandlesActive);
+
 					// No constraint instance
 					NewJoint->userData = NULL;
 					HandleInfo->HandleData = NewJoint;
@@ -4367,6 +4830,60 @@ static void PullBackHitComp(FHitResult& Hit, const FVector& Start, const FVector
 	Hit.Time = FMath::Clamp(Hit.Time - DesiredTimeBack, 0.f, 1.f);
 }
 
+bool UGripMotionControllerComponent::SweepGripComponent(TArray<FHitResult> & OutHits, UPrimitiveComponent * Component, FVector & Start, FVector & End, const FQuat & Rot, const FComponentQueryParams & Params)
+{
+	UWorld * MyWorld = GetWorld();
+
+	if (!MyWorld || !Component)
+		return false;
+
+	if (GripSweepMode == EVRGripSweepMode::Sync)
+		return MyWorld->ComponentSweepMulti(OutHits, Component, Start, End, Rot, Params);
+
+	OutHits.Reset();
+	FGripAsyncSweep & Sweep = GripAsyncSweeps.FindOrAdd(Component);
+
+	// Results are only held for the frame after the trace was queued, if we skipped a frame just wait for the next one
+	FTraceDatum Datum;
+	const bool bHasResults = Sweep.LastUsedFrame + 1 == GFrameCounter && MyWorld->QueryTraceData(Sweep.Handle, Datum);
+	const FVector LastStart = Sweep.Start;
+	const FVector LastEnd = Sweep.End;
+
+	// Queue this frames sweep, shape components sweep their own shape, everything else sweeps its world bounds
+	const bool bIsShape = Component->IsA<UShapeComponent>();
+	const FVector BoundsOffset = bIsShape ? FVector::ZeroVector : Component->Bounds.Origin - Component->GetComponentLocation();
+
+	Sweep.Start = Start;
+	Sweep.End = End;
+	Sweep.LastUsedFrame = GFrameCounter;
+	Sweep.Handle = MyWorld->AsyncSweepByChannel(
+		EAsyncTraceType::Multi,
+		Start + BoundsOffset,
+		End + BoundsOffset,
+		bIsShape ? Rot : FQuat::Identity,
+		Component->GetCollisionObjectType(),
+		Component->GetCollisionShape(),
+		Params,
+		FCollisionResponseParams(Component->GetCollisionResponseToChannels())
+	);
+
+	if (!bHasResults)
+		return false;
+
+	// Hand back the positions that the results were generated with so that pull back is correct
+	Start = LastStart;
+	End = LastEnd;
+	OutHits = MoveTemp(Datum.OutHits);
+
+	for (const FHitResult & Hit : OutHits)
+	{
+		if (Hit.bBlockingHit)
+			return true;
+	}
+
+	return false;
+}
+
 bool UGripMotionControllerComponent::CheckComponentWithSweep(UPrimitiveComponent * ComponentToCheck, FVector Move, FRotator newOrientation, bool bSkipSimulatingComponents/*,  bool &bHadBlockingHitOut*/)
 {
 	TArray<FHitResult> Hits;
@@ -4397,14 +4914,13 @@ bool UGripMotionControllerComponent::CheckComponentWithSweep(UPrimitiveComponent
 		}
 #endif
 
-		UWorld* const MyWorld = GetWorld();
 		FComponentQueryParams Params(TEXT("sweep_params"), root->GetOwner());
 
 		FCollisionResponseParams ResponseParam;
 		root->InitSweepCollisionParams(Params, ResponseParam);
 
 		FVector end = start + Move;
-		bool const bHadBlockingHit = MyWorld->ComponentSweepMulti(Hits, root, start, end, newOrientation.Quaternion(), Params);
+		bool const bHadBlockingHit = SweepGripComponent(Hits, root, start, end, newOrientation.Quaternion(), Params);
 
 		if (Hits.Num() > 0)
 		{
@@ -4496,6 +5012,10 @@ bool UGripMotionControllerComponent::GripPollControllerState(FVector& Position,
 
 	bool bIsInGameThread = IsInGameThread();
 
+	// Pose sources are only applied in the game thread tick, there is no newer pose for the late update to use
+	if (PoseSource)
+		return false;
+
 	if (bHasAuthority)
 	{
 		// New iteration and retrieval for 4.12
@@ -4869,7 +5389,10 @@ void UGripMotionControllerComponent::GetControllerDeviceID(FXRDeviceId & DeviceI
 */
 
 FExpandedLateUpdateManager::FExpandedLateUpdateManager()
-	: LateUpdateGameWriteIndex(0)
+	: CachedGeneration(0)
+	, FramesSinceCacheRebuild(0)
+	, bHasComponentCache(false)
+	, LateUpdateGameWriteIndex(0)
 	, LateUpdateRenderReadIndex(0)
 {
 	SkipLateUpdate[0] = false;
@@ -4885,18 +5408,22 @@ void FExpandedLateUpdateManager::Setup(const FTransform& ParentToWorld, UGripMot
 
 	LateUpdateParentToWorld[LateUpdateGameWriteIndex] = ParentToWorld;
 	LateUpdatePrimitives[LateUpdateGameWriteIndex].Reset();
-	GatherLateUpdatePrimitives(Component);
 	SkipLateUpdate[LateUpdateGameWriteIndex] = bSkipLateUpdate;
 
-	//Add additional late updates registered to this controller that aren't children and aren't gripped
-	//This array is editable in blueprint and can be used for things like arms or the like.
-
-	for (UPrimitiveComponent* primComp : Component->AdditionalLateUpdateComponents)
+	// Only walk the component hierarchies when something changed, otherwise just refresh the scene infos from the cache
+	if (!bHasComponentCache ||
+		CachedGeneration != Component->LateUpdateGeneration ||
+		CachedAdditionalComponents != Component->AdditionalLateUpdateComponents ||
+		++FramesSinceCacheRebuild >= GripMotionControllerCvars::LateUpdateCacheRefreshFrames)
 	{
-		if (primComp)
-			GatherLateUpdatePrimitives(primComp);
+		RebuildComponentCache(Component);
 	}
 
+	for (const TWeakObjectPtr<UPrimitiveComponent> & PrimComp : CachedControllerComponents)
+	{
+		if (PrimComp.IsValid())
+			CacheSceneInfo(PrimComp.Get());
+	}
 
 	ProcessGripArrayLateUpdatePrimitives(Component, Component->LocallyGrippedObjects);
 	ProcessGripArrayLateUpdatePrimitives(Component, Component->GrippedObjects);
@@ -4948,10 +5475,31 @@ void FExpandedLateUpdateManager::PostRender_RenderThread()
 	LateUpdateRenderReadIndex = (LateUpdateRenderReadIndex + 1) % 2;
 }
 
-void FExpandedLateUpdateManager::CacheSceneInfo(USceneComponent* Component)
+void FExpandedLateUpdateManager::RebuildComponentCache(UGripMotionControllerComponent* Component)
+{
+	CachedControllerComponents.Reset();
+	CachedGripComponents.Reset();
+
+	GatherLateUpdatePrimitives(Component, CachedControllerComponents);
+
+	//Add additional late updates registered to this controller that aren't children and aren't gripped
+	//This array is editable in blueprint and can be used for things like arms or the like.
+
+	for (UPrimitiveComponent* primComp : Component->AdditionalLateUpdateComponents)
+	{
+		if (primComp)
+			GatherLateUpdatePrimitives(primComp, CachedControllerComponents);
+	}
+
+	CachedAdditionalComponents = Component->AdditionalLateUpdateComponents;
+	CachedGeneration = Component->LateUpdateGeneration;
+	FramesSinceCacheRebuild = 0;
+	bHasComponentCache = true;
+}
+
+void FExpandedLateUpdateManager::CacheSceneInfo(UPrimitiveComponent* PrimitiveComponent)
 {
 	// If a scene proxy is present, cache it
-	UPrimitiveComponent* PrimitiveComponent = dynamic_cast<UPrimitiveComponent*>(Component);
 	if (PrimitiveComponent && PrimitiveComponent->SceneProxy)
 	{
 		FPrimitiveSceneInfo* PrimitiveSceneInfo = PrimitiveComponent->SceneProxy->GetPrimitiveSceneInfo();
@@ -4965,17 +5513,17 @@ void FExpandedLateUpdateManager::CacheSceneInfo(USceneComponent* Component)
 	}
 }
 
-void FExpandedLateUpdateManager::GatherLateUpdatePrimitives(USceneComponent* ParentComponent)
+void FExpandedLateUpdateManager::GatherLateUpdatePrimitives(USceneComponent* ParentComponent, TArray<TWeakObjectPtr<UPrimitiveComponent>> & OutComponents)
 {
-	CacheSceneInfo(ParentComponent);
+	if (UPrimitiveComponent * PrimComp = Cast<UPrimitiveComponent>(ParentComponent))
+		OutComponents.Add(PrimComp);
 
 	TArray<USceneComponent*> Components;
 	ParentComponent->GetChildrenComponents(true, Components);
 	for (USceneComponent* Component : Components)
 	{	
-		if (Component != nullptr)
-		if (Component != nullptr)
-			CacheSceneInfo(Component);
+		if (UPrimitiveComponent * PrimComp = Cast<UPrimitiveComponent>(Component))
+			OutComponents.Add(PrimComp);
 	}
 }
 
@@ -5030,6 +5578,20 @@ void FExpandedLateUpdateManager::ProcessGripArrayLateUpdatePrimitives(UGripMotio
 		{}break;
 		}
 
+		// Use the cached hierarchy for this object if we already walked it since the last rebuild
+		if (TArray<TWeakObjectPtr<UPrimitiveComponent>> * CachedComponents = CachedGripComponents.Find(actor.GrippedObject))
+		{
+			for (const TWeakObjectPtr<UPrimitiveComponent> & PrimComp : *CachedComponents)
+			{
+				if (PrimComp.IsValid())
+					CacheSceneInfo(PrimComp.Get());
+			}
+
+			continue;
+		}
+
+		TArray<TWeakObjectPtr<UPrimitiveComponent>> & GripComponents = CachedGripComponents.Add(actor.GrippedObject);
+
 		// Get late update primitives
 		switch (actor.GripTargetType)
 		{
@@ -5041,7 +5603,7 @@ void FExpandedLateUpdateManager::ProcessGripArrayLateUpdatePrimitives(UGripMotio
 			{
 				if (USceneComponent * rootComponent = pActor->GetRootComponent())
 				{
-					GatherLateUpdatePrimitives(rootComponent);
+					GatherLateUpdatePrimitives(rootComponent, GripComponents);
 				}
 			}
 
@@ -5053,9 +5615,14 @@ void FExpandedLateUpdateManager::ProcessGripArrayLateUpdatePrimitives(UGripMotio
 			UPrimitiveComponent * cPrimComp = actor.GetGrippedComponent();
 			if (cPrimComp)
 			{
-				GatherLateUpdatePrimitives(cPrimComp);
+				GatherLateUpdatePrimitives(cPrimComp, GripComponents);
 			}
 		}break;
 		}
+
+		for (const TWeakObjectPtr<UPrimitiveComponent> & PrimComp : GripComponents)
+		{
+			CacheSceneInfo(PrimComp.Get());
+		}
 	}
 }
\ No newline at end of file
@@ -40,10 +40,19 @@ void UVRButtonComponent::BeginPlay()
 	// Call the base class 
 	Super::BeginPlay();
 
+	UVRInteractibleFunctionLibrary::Interactible_AddToTickStats(this);
+
 	ResetInitialButtonLocation();
 	SetButtonToRestingPosition();
 }
 
+void UVRButtonComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UVRInteractibleFunctionLibrary::Interactible_RemoveFromTickStats(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UVRButtonComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	// Call supers tick (though I don't think any of the base classes to this actually implement it)
@@ -95,7 +104,7 @@ void UVRButtonComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 		// Std precision tolerance should be fine
 		if (this->RelativeLocation.Equals(GetTargetRelativeLocation()))
 		{
-			this->SetComponentTickEnabled(false);
+			UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
 			InteractingComponent.Reset(); // Just reset it here so it only does it once
 		}
 		else
@@ -230,7 +239,7 @@ void UVRButtonComponent::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AAc
 		InitialComponentLoc = OriginalBaseTransform.InverseTransformPosition(this->GetComponentLocation());
 		bToggledThisTouch = false;
 
-		this->SetComponentTickEnabled(true);
+		UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, true);
 	}
 }
 
@@ -70,9 +70,18 @@ void UVRDialComponent::BeginPlay()
 	// Call the base class 
 	Super::BeginPlay();
 
+	UVRInteractibleFunctionLibrary::Interactible_AddToTickStats(this);
+
 	ResetInitialDialLocation();
 }
 
+void UVRDialComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UVRInteractibleFunctionLibrary::Interactible_RemoveFromTickStats(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UVRDialComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	if (bIsLerping)
@@ -85,7 +94,7 @@ void UVRDialComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 
 		if (CurRotBackEnd == 0.f)
 		{
-			this->SetComponentTickEnabled(false);
+			UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
 			bIsLerping = false;
 			OnDialFinishedLerping.Broadcast();
 			ReceiveDialFinishedLerping();
@@ -93,7 +102,7 @@ void UVRDialComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 	}
 	else
 	{
-		this->SetComponentTickEnabled(false);
+		UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
 	}
 }
 
@@ -136,7 +145,9 @@ void UVRDialComponent::OnGrip_Implementation(UGripMotionControllerComponent * Gr
 	//LastRotation = RelativeToGripTransform.GetRelativeTransform(CurrentRelativeTransform).Rotator();
 	LastRotation = RelativeToGripTransform.GetRotation().Rotator(); // Forcing into world space now so that initial can be correct over the network
 
+	// Gripped dials are driven by TickGrip, stop any lerp back tick
 	bIsLerping = false;
+	UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
 }
 
 void UVRDialComponent::OnGripRelease_Implementation(UGripMotionControllerComponent * ReleasingController, const FBPActorGripInformation & GripInformation, bool bWasSocketed) 
@@ -151,10 +162,10 @@ void UVRDialComponent::OnGripRelease_Implementation(UGripMotionControllerCompone
 	if (bLerpBackOnRelease)
 	{
 		bIsLerping = true;
-		this->SetComponentTickEnabled(true);
+		UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, true);
 	}
 	else
-		this->SetComponentTickEnabled(false);
+		UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
 }
 
 void UVRDialComponent::OnChildGrip_Implementation(UGripMotionControllerComponent * GrippingController, const FBPActorGripInformation & GripInformation) {}
@@ -3,4 +3,53 @@
 #include "Engine/Engine.h"
 
 //General Log
-DEFINE_LOG_CATEGORY(VRInteractibleFunctionLibraryLog);
\ No newline at end of file
+DEFINE_LOG_CATEGORY(VRInteractibleFunctionLibraryLog);
+
+DECLARE_STATS_GROUP(TEXT("VRInteractibles"), STATGROUP_VRInteractibles, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Interactibles Active"), STAT_VRInteractiblesActive, STATGROUP_VRInteractibles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Interactibles Idle"), STAT_VRInteractiblesIdle, STATGROUP_VRInteractibles);
+
+void UVRInteractibleFunctionLibrary::Interactible_SetTickActive(UActorComponent * Interactible, bool bTickActive)
+{
+	if (!Interactible || Interactible->IsComponentTickEnabled() == bTickActive)
+		return;
+
+	Interactible->SetComponentTickEnabled(bTickActive);
+
+	// Only counted while in play
+	if (Interactible->HasBegunPlay())
+	{
+		if (bTickActive)
+		{
+			INC_DWORD_STAT(STAT_VRInteractiblesActive);
+			DEC_DWORD_STAT(STAT_VRInteractiblesIdle);
+		}
+		else
+		{
+			DEC_DWORD_STAT(STAT_VRInteractiblesActive);
+			INC_DWORD_STAT(STAT_VRInteractiblesIdle);
+		}
+	}
+}
+
+void UVRInteractibleFunctionLibrary::Interactible_AddToTickStats(UActorComponent * Interactible)
+{
+	if (!Interactible)
+		return;
+
+	if (Interactible->IsComponentTickEnabled())
+		INC_DWORD_STAT(STAT_VRInteractiblesActive);
+	else
+		INC_DWORD_STAT(STAT_VRInteractiblesIdle);
+}
+
+void UVRInteractibleFunctionLibrary::Interactible_RemoveFromTickStats(UActorComponent * Interactible)
+{
+	if (!Interactible)
+		return;
+
+	if (Interactible->IsComponentTickEnabled())
+		DEC_DWORD_STAT(STAT_VRInteractiblesActive);
+	else
+		DEC_DWORD_STAT(STAT_VRInteractiblesIdle);
+}
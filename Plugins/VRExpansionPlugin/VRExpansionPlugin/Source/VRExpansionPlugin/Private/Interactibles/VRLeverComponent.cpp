@@ -96,6 +96,8 @@ void UVRLeverComponent::BeginPlay()
 	// Call the base class 
 	Super::BeginPlay();
 
+	UVRInteractibleFunctionLibrary::Interactible_AddToTickStats(this);
+
 	// If we are the server, or this component doesn't replicate then get the initial lever location
 	if (!bReplicates || GetNetMode() < ENetMode::NM_Client)
 	{
@@ -103,6 +105,13 @@ void UVRLeverComponent::BeginPlay()
 	}
 }
 
+void UVRLeverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UVRInteractibleFunctionLibrary::Interactible_RemoveFromTickStats(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UVRLeverComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	// Call supers tick (though I don't think any of the base classes to this actually implement it)
@@ -131,7 +140,7 @@ void UVRLeverComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 
 			if (LerpedRot.Equals(FRotator::ZeroRotator))
 			{
-				this->SetComponentTickEnabled(false);
+				UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
 				bIsLerping = false;
 				bReplicateMovement = true;
 				this->SetRelativeRotation((FTransform::Identity * InitialRelativeTransform).Rotator());
@@ -320,7 +329,7 @@ void UVRLeverComponent::OnGrip_Implementation(UGripMotionControllerComponent * G
 		bReplicateMovement = false;
 	}
 
-	this->SetComponentTickEnabled(true);
+	UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, true);
 }
 
 void UVRLeverComponent::OnGripRelease_Implementation(UGripMotionControllerComponent * ReleasingController, const FBPActorGripInformation & GripInformation, bool bWasSocketed) 
@@ -338,7 +347,7 @@ void UVRLeverComponent::OnGripRelease_Implementation(UGripMotionControllerCompon
 	}
 	else
 	{
-		this->SetComponentTickEnabled(false);
+		UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
 		bReplicateMovement = true;
 	}
 }
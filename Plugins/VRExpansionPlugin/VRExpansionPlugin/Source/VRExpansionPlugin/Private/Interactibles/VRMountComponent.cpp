@@ -34,6 +34,8 @@ UVRMountComponent::UVRMountComponent(const FObjectInitializer& ObjectInitializer
 	FlipingZone = 0.4;
 	FlipReajustYawSpeed = 7.7;
 
+	bNeedsTickWhileHeld = false;
+
 	// Set to only overlap with things so that its not ruined by touching over actors
 	this->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Overlap);
 }
@@ -71,6 +73,10 @@ void UVRMountComponent::BeginPlay()
 	Super::BeginPlay();
 
 	ResetInitialMountLocation();
+
+	// Native tick does nothing, don't make held mounts pay for it unless a subclass or blueprint wants it
+	if (!bNeedsTickWhileHeld)
+		bNeedsTickWhileHeld = GetClass()->IsFunctionImplementedInBlueprint(GET_FUNCTION_NAME_CHECKED(UVRMountComponent, ReceiveTick));
 }
 
 void UVRMountComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
@@ -402,7 +408,8 @@ void UVRMountComponent::OnGrip_Implementation(UGripMotionControllerComponent * G
 		
 
 
-	this->SetComponentTickEnabled(true);
+	if (bNeedsTickWhileHeld)
+		this->SetComponentTickEnabled(true);
 }
 
 void UVRMountComponent::OnGripRelease_Implementation(UGripMotionControllerComponent * ReleasingController, const FBPActorGripInformation & GripInformation, bool bWasSocketed)
@@ -95,6 +95,8 @@ void UVRSliderComponent::BeginPlay()
 	// Call the base class 
 	Super::BeginPlay();
 
+	UVRInteractibleFunctionLibrary::Interactible_AddToTickStats(this);
+
 	// If we are the server, or this component doesn't replicate then get the initial lever location
 	if (!bReplicates || GetNetMode() < ENetMode::NM_Client)
 	{
@@ -113,6 +115,13 @@ void UVRSliderComponent::BeginPlay()
 	}
 }
 
+void UVRSliderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UVRInteractibleFunctionLibrary::Interactible_RemoveFromTickStats(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UVRSliderComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	// Call supers tick (though I don't think any of the base classes to this actually implement it)
@@ -170,13 +179,17 @@ void UVRSliderComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 			OnSliderFinishedLerping.Broadcast(CurrentSliderProgress);
 			ReceiveSliderFinishedLerping(CurrentSliderProgress);
 
-			this->SetComponentTickEnabled(false);
+			UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
 			bReplicateMovement = true;
 		}
 		
 		// Check for the hit point always
 		CheckSliderProgress();
 	}
+	else
+	{
+		UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
+	}
 }
 
 void UVRSliderComponent::TickGrip_Implementation(UGripMotionControllerComponent * GrippingController, const FBPActorGripInformation & GripInformation, float DeltaTime) 
@@ -355,6 +368,9 @@ void UVRSliderComponent::OnGrip_Implementation(UGripMotionControllerComponent *
 	bIsLerping = false;
 	MomentumAtDrop = 0.0f;
 
+	// Gripped sliders are driven by TickGrip, stop any momentum tick
+	UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
+
 	if (GripInformation.GripMovementReplicationSetting != EGripMovementReplicationSettings::ForceServerSideMovement)
 	{
 		bReplicateMovement = false;
@@ -368,11 +384,11 @@ void UVRSliderComponent::OnGripRelease_Implementation(UGripMotionControllerCompo
 	if (SliderBehaviorWhenReleased != EVRInteractibleSliderDropBehavior::Stay)
 	{
 		bIsLerping = true;
-		this->SetComponentTickEnabled(true);
+		UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, true);
 	}
 	else
 	{
-		this->SetComponentTickEnabled(false);
+		UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
 		bReplicateMovement = true;
 	}
 }
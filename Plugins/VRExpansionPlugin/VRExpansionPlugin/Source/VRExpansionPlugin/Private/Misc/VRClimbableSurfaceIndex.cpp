@@ -0,0 +1,222 @@
+#include "Misc/VRClimbableSurfaceIndex.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Components/PrimitiveComponent.h"
+
+DEFINE_LOG_CATEGORY(LogVRClimbableIndex);
+
+TArray<TWeakObjectPtr<AVRClimbableSurfaceIndex>> AVRClimbableSurfaceIndex::ActiveIndices;
+
+AVRClimbableSurfaceIndex::AVRClimbableSurfaceIndex(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	ClimbableTag = FName(TEXT("Climbable"));
+	CellSize = 100.0f;
+}
+
+void AVRClimbableSurfaceIndex::BeginPlay()
+{
+	Super::BeginPlay();
+
+	IndexedActorLookup.Reset();
+	for (AActor * IndexedActor : IndexedActors)
+	{
+		if (IndexedActor)
+			IndexedActorLookup.Add(IndexedActor);
+	}
+
+	ActiveIndices.AddUnique(this);
+}
+
+void AVRClimbableSurfaceIndex::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ActiveIndices.Remove(this);
+	Super::EndPlay(EndPlayReason);
+}
+
+FIntVector AVRClimbableSurfaceIndex::GetCell(const FVector & Location) const
+{
+	return FIntVector(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize), FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void AVRClimbableSurfaceIndex::AddLedge(const FVector & Start, const FVector & End, const FVector & OutwardNormal)
+{
+	FVRClimbableLedge NewLedge;
+	NewLedge.Start = Start;
+	NewLedge.End = End;
+	NewLedge.OutwardNormal = OutwardNormal;
+	const int32 LedgeIndex = Ledges.Add(NewLedge);
+
+	// Add it to every cell that its bounds touch
+	const FIntVector MinCell = GetCell(Start.ComponentMin(End));
+	const FIntVector MaxCell = GetCell(Start.ComponentMax(End));
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				Cells.FindOrAdd(FIntVector(X, Y, Z)).LedgeIndices.Add(LedgeIndex);
+			}
+		}
+	}
+}
+
+void AVRClimbableSurfaceIndex::BuildIndex()
+{
+	Ledges.Reset();
+	Cells.Reset();
+	IndexedActors.Reset();
+	IndexedActorLookup.Reset();
+
+	ULevel * MyLevel = GetLevel();
+	if (!MyLevel)
+		return;
+
+	int32 SkippedComponents = 0;
+	int32 SkippedMovableActors = 0;
+
+	for (AActor * LevelActor : MyLevel->Actors)
+	{
+		if (!LevelActor || LevelActor == this || !LevelActor->ActorHasTag(ClimbableTag))
+			continue;
+
+		bool bIndexedAny = false;
+
+		TInlineComponentArray<UPrimitiveComponent*> Primitives;
+		LevelActor->GetComponents(Primitives);
+
+		// Ledges are baked at the build pose, anything that can move would go stale so leave the whole actor to the sweeps
+		bool bHasMovableCollision = false;
+		for (UPrimitiveComponent * Primitive : Primitives)
+		{
+			if (Primitive && Primitive->IsCollisionEnabled() && Primitive->Mobility != EComponentMobility::Static)
+			{
+				bHasMovableCollision = true;
+				break;
+			}
+		}
+
+		if (bHasMovableCollision)
+		{
+			++SkippedMovableActors;
+			continue;
+		}
+
+		for (UPrimitiveComponent * Primitive : Primitives)
+		{
+			if (!Primitive || !Primitive->IsCollisionEnabled())
+				continue;
+
+			const FTransform & CompTransform = Primitive->GetComponentTransform();
+
+			// Ledges are the top edges of the components local bounds, so only upright components are supported
+			if (CompTransform.GetUnitAxis(EAxis::Z).Z < 0.9f)
+			{
+				++SkippedComponents;
+				continue;
+			}
+
+			const FBox LocalBox = Primitive->CalcBounds(FTransform::Identity).GetBox();
+			if (!LocalBox.IsValid)
+				continue;
+
+			const FVector TopCorners[4] =
+			{
+				CompTransform.TransformPosition(FVector(LocalBox.Min.X, LocalBox.Min.Y, LocalBox.Max.Z)),
+				CompTransform.TransformPosition(FVector(LocalBox.Max.X, LocalBox.Min.Y, LocalBox.Max.Z)),
+				CompTransform.TransformPosition(FVector(LocalBox.Max.X, LocalBox.Max.Y, LocalBox.Max.Z)),
+				CompTransform.TransformPosition(FVector(LocalBox.Min.X, LocalBox.Max.Y, LocalBox.Max.Z))
+			};
+
+			const FVector TopCenter = (TopCorners[0] + TopCorners[1] + TopCorners[2] + TopCorners[3]) * 0.25f;
+
+			for (int32 EdgeIndex = 0; EdgeIndex < 4; ++EdgeIndex)
+			{
+				const FVector & EdgeStart = TopCorners[EdgeIndex];
+				const FVector & EdgeEnd = TopCorners[(EdgeIndex + 1) % 4];
+
+				if (EdgeStart.Equals(EdgeEnd, KINDA_SMALL_NUMBER))
+					continue;
+
+				const FVector OutwardNormal = (((EdgeStart + EdgeEnd) * 0.5f) - TopCenter).GetSafeNormal2D();
+				AddLedge(EdgeStart, EdgeEnd, OutwardNormal);
+			}
+
+			bIndexedAny = true;
+		}
+
+		if (bIndexedAny)
+		{
+			IndexedActors.Add(LevelActor);
+			IndexedActorLookup.Add(LevelActor);
+		}
+	}
+
+	if (SkippedMovableActors > 0)
+	{
+		UE_LOG(LogVRClimbableIndex, Warning, TEXT("%s skipped %d climbable actors with non static collision, they fall back to sweeps"), *GetName(), SkippedMovableActors);
+	}
+
+	if (SkippedComponents > 0)
+	{
+		UE_LOG(LogVRClimbableIndex, Warning, TEXT("%s skipped %d non upright climbable components, they fall back to sweeps"), *GetName(), SkippedComponents);
+	}
+
+	UE_LOG(LogVRClimbableIndex, Log, TEXT("%s indexed %d ledges from %d actors into %d cells"), *GetName(), Ledges.Num(), IndexedActors.Num(), Cells.Num());
+
+	MarkPackageDirty();
+}
+
+bool AVRClimbableSurfaceIndex::IsActorIndexed(const AActor * Actor) const
+{
+	return Actor && IndexedActorLookup.Contains(Actor);
+}
+
+bool AVRClimbableSurfaceIndex::HasLedgeNear(const FVector & Point, float MinZ, float MaxZ, float Radius) const
+{
+	const FIntVector MinCell = GetCell(FVector(Point.X - Radius, Point.Y - Radius, MinZ));
+	const FIntVector MaxCell = GetCell(FVector(Point.X + Radius, Point.Y + Radius, MaxZ));
+	const FVector Point2D(Point.X, Point.Y, 0.0f);
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const FVRClimbableCell * Cell = Cells.Find(FIntVector(X, Y, Z));
+				if (!Cell)
+					continue;
+
+				for (int32 LedgeIndex : Cell->LedgeIndices)
+				{
+					const FVRClimbableLedge & Ledge = Ledges[LedgeIndex];
+
+					if (FMath::Max(Ledge.Start.Z, Ledge.End.Z) < MinZ || FMath::Min(Ledge.Start.Z, Ledge.End.Z) > MaxZ)
+						continue;
+
+					if (FMath::PointDistToSegment(Point2D, FVector(Ledge.Start.X, Ledge.Start.Y, 0.0f), FVector(Ledge.End.X, Ledge.End.Y, 0.0f)) <= Radius)
+						return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+const AVRClimbableSurfaceIndex * AVRClimbableSurfaceIndex::FindIndexForActor(const UWorld * World, const AActor * Actor)
+{
+	if (!World || !Actor)
+		return nullptr;
+
+	for (const TWeakObjectPtr<AVRClimbableSurfaceIndex> & Index : ActiveIndices)
+	{
+		if (Index.IsValid() && Index->GetWorld() == World && Index->IsActorIndexed(Actor))
+			return Index.Get();
+	}
+
+	return nullptr;
+}
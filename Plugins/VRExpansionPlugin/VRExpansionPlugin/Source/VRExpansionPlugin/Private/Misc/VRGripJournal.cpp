@@ -0,0 +1,498 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRGripJournal.h"
+#include "GripMotionControllerComponent.h"
+#include "HAL/FileManager.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "Misc/App.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY(LogVRGripJournal);
+
+// 'VRGJ'
+static const uint32 GripJournalMagic = 0x4A475256;
+static const int32 GripJournalVersion = 2;
+
+bool FVRGripJournal::bIsRecording = false;
+
+FArchive & operator<<(FArchive & Ar, FVRGripJournalRecord & Record)
+{
+	uint8 Type = (uint8)Record.Type;
+
+	Ar << Record.Frame;
+	Ar << Record.WorldTime;
+	Ar << Record.ControllerName;
+	Ar << Record.ObjectName;
+	Ar << Type;
+	Ar << Record.GripID;
+	Ar << Record.GripCollisionType;
+	Ar << Record.GripLateUpdateSetting;
+	Ar << Record.GripMovementReplicationSetting;
+	Ar << Record.bSimulate;
+	Ar << Record.Stiffness;
+	Ar << Record.Damping;
+	Ar << Record.Location;
+	Ar << Record.Rotation;
+
+	Record.Type = (EVRGripJournalRecordType)Type;
+	return Ar;
+}
+
+FVRGripJournal::FVRGripJournal()
+	: MaxRecords(0)
+	, NextRecord(0)
+	, bWrapped(false)
+{
+}
+
+FVRGripJournal & FVRGripJournal::Get()
+{
+	static FVRGripJournal Journal;
+	return Journal;
+}
+
+void FVRGripJournal::StartRecording(int32 InMaxRecords)
+{
+	MaxRecords = FMath::Max(InMaxRecords, 1);
+
+	// Allocate the whole ring up front so recording never allocates
+	Records.Reset(MaxRecords);
+	NextRecord = 0;
+	bWrapped = false;
+
+	Names.Reset();
+	NameLookup.Reset();
+
+	bIsRecording = true;
+}
+
+bool FVRGripJournal::StopRecording(const FString & FilePath)
+{
+	bIsRecording = false;
+
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!FileWriter)
+	{
+		UE_LOG(LogVRGripJournal, Warning, TEXT("Failed to open %s to write the grip journal"), *FilePath);
+		return false;
+	}
+
+	uint32 Magic = GripJournalMagic;
+	int32 Version = GripJournalVersion;
+	int32 NumRecords = Records.Num();
+
+	*FileWriter << Magic;
+	*FileWriter << Version;
+	*FileWriter << Names;
+	*FileWriter << NumRecords;
+
+	// Write out oldest to newest
+	const int32 FirstRecord = bWrapped ? NextRecord : 0;
+	for (int32 i = 0; i < NumRecords; ++i)
+	{
+		*FileWriter << Records[(FirstRecord + i) % NumRecords];
+	}
+
+	FileWriter->Close();
+
+	UE_LOG(LogVRGripJournal, Log, TEXT("Wrote %d grip journal records to %s%s"), NumRecords, *FilePath, bWrapped ? TEXT(" (ring wrapped, oldest records were dropped)") : TEXT(""));
+	return true;
+}
+
+bool FVRGripJournal::LoadFromFile(const FString & FilePath, TArray<FString> & OutNames, TArray<FVRGripJournalRecord> & OutRecords)
+{
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!FileReader)
+	{
+		UE_LOG(LogVRGripJournal, Warning, TEXT("Failed to open grip journal %s"), *FilePath);
+		return false;
+	}
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 NumRecords = 0;
+
+	*FileReader << Magic;
+	*FileReader << Version;
+
+	if (Magic != GripJournalMagic || Version != GripJournalVersion)
+	{
+		UE_LOG(LogVRGripJournal, Warning, TEXT("%s is not a grip journal or is from a different version"), *FilePath);
+		return false;
+	}
+
+	*FileReader << OutNames;
+	*FileReader << NumRecords;
+
+	if (FileReader->IsError() || NumRecords < 0)
+		return false;
+
+	OutRecords.SetNum(NumRecords);
+	for (FVRGripJournalRecord & Record : OutRecords)
+	{
+		*FileReader << Record;
+	}
+
+	return !FileReader->IsError();
+}
+
+FString FVRGripJournal::GetDefaultFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("GripJournals") / TEXT("GripJournal.vrgj");
+}
+
+FString FVRGripJournal::GetJournalName(const UObject * Object)
+{
+	if (!Object)
+		return FString();
+
+	if (const UActorComponent * Component = Cast<UActorComponent>(Object))
+	{
+		if (AActor * Owner = Component->GetOwner())
+		{
+			return Owner->GetName() + TEXT(".") + Component->GetName();
+		}
+	}
+
+	return Object->GetName();
+}
+
+int32 FVRGripJournal::GetNameIndex(const UObject * Object)
+{
+	if (!Object)
+		return INDEX_NONE;
+
+	if (int32 * ExistingIndex = NameLookup.Find(FObjectKey(Object)))
+		return *ExistingIndex;
+
+	const int32 NewIndex = Names.Add(GetJournalName(Object));
+	NameLookup.Add(FObjectKey(Object), NewIndex);
+	return NewIndex;
+}
+
+FVRGripJournalRecord & FVRGripJournal::AddRecord(EVRGripJournalRecordType Type, const USceneComponent * Component)
+{
+	FVRGripJournalRecord * Record;
+
+	if (Records.Num() < MaxRecords)
+	{
+		Record = &Records[Records.AddDefaulted()];
+	}
+	else
+	{
+		Record = &Records[NextRecord];
+		*Record = FVRGripJournalRecord();
+		bWrapped = true;
+	}
+
+	NextRecord = (NextRecord + 1) % MaxRecords;
+
+	Record->Type = Type;
+	Record->Frame = (uint32)GFrameCounter;
+	Record->ControllerName = GetNameIndex(Component);
+
+	if (UWorld * World = Component ? Component->GetWorld() : nullptr)
+		Record->WorldTime = World->GetTimeSeconds();
+
+	return *Record;
+}
+
+void FVRGripJournal::RecordPose(const USceneComponent * Component)
+{
+	if (!bIsRecording || !Component)
+		return;
+
+	FVRGripJournalRecord & Record = AddRecord(EVRGripJournalRecordType::ControllerPose, Component);
+	Record.Location = Component->RelativeLocation;
+	Record.Rotation = Component->RelativeRotation.Quaternion();
+}
+
+void FVRGripJournal::RecordGripEvent(EVRGripJournalRecordType Type, const UGripMotionControllerComponent * Controller, const FBPActorGripInformation & Grip, bool bSimulate)
+{
+	if (!bIsRecording || !Controller)
+		return;
+
+	FVRGripJournalRecord & Record = AddRecord(Type, Controller);
+	Record.ObjectName = GetNameIndex(Grip.GrippedObject);
+	Record.GripID = Grip.GripID;
+	Record.GripCollisionType = (uint8)Grip.GripCollisionType;
+	Record.GripLateUpdateSetting = (uint8)Grip.GripLateUpdateSetting;
+	Record.GripMovementReplicationSetting = (uint8)Grip.GripMovementReplicationSetting;
+	Record.bSimulate = bSimulate;
+	Record.Stiffness = Grip.Stiffness;
+	Record.Damping = Grip.Damping;
+	Record.Location = Grip.RelativeTransform.GetLocation();
+	Record.Rotation = Grip.RelativeTransform.GetRotation();
+}
+
+FVRGripJournalReplay::FVRGripJournalReplay(UWorld * InWorld, TArray<FString> && InNames, TArray<FVRGripJournalRecord> && InRecords, bool bInExitWhenDone)
+	: World(InWorld)
+	, Names(MoveTemp(InNames))
+	, Records(MoveTemp(InRecords))
+	, NextRecord(0)
+	, bFinished(false)
+	, bExitWhenDone(bInExitWhenDone)
+	, FramesPlayed(0)
+	, MissingObjects(0)
+	, TotalFrameTime(0.0)
+	, MaxFrameTime(0.0)
+{
+}
+
+bool FVRGripJournalReplay::IsTickable() const
+{
+	return !bFinished;
+}
+
+void FVRGripJournalReplay::Tick(float DeltaTime)
+{
+	if (!World.IsValid())
+	{
+		Finish();
+		return;
+	}
+
+	if (NextRecord >= Records.Num())
+	{
+		Finish();
+		return;
+	}
+
+	// Skip the first frame, it is the one that the replay was started on
+	if (FramesPlayed > 0)
+	{
+		const double FrameTime = FApp::GetDeltaTime();
+		TotalFrameTime += FrameTime;
+		MaxFrameTime = FMath::Max(MaxFrameTime, FrameTime);
+	}
+
+	// Play back everything recorded on the next journal frame
+	const uint32 Frame = Records[NextRecord].Frame;
+	while (NextRecord < Records.Num() && Records[NextRecord].Frame == Frame)
+	{
+		ApplyRecord(Records[NextRecord]);
+		++NextRecord;
+	}
+
+	++FramesPlayed;
+}
+
+UObject * FVRGripJournalReplay::FindJournalObject(int32 NameIndex)
+{
+	if (!Names.IsValidIndex(NameIndex))
+		return nullptr;
+
+	if (TWeakObjectPtr<UObject> * Resolved = ResolvedObjects.Find(NameIndex))
+	{
+		if (Resolved->IsValid())
+			return Resolved->Get();
+	}
+
+	const FString & Name = Names[NameIndex];
+	FString ActorName = Name;
+	FString ComponentName;
+	Name.Split(TEXT("."), &ActorName, &ComponentName);
+
+	UObject * FoundObject = nullptr;
+	for (TActorIterator<AActor> It(World.Get()); It; ++It)
+	{
+		if (It->GetName() != ActorName)
+			continue;
+
+		if (ComponentName.IsEmpty())
+		{
+			FoundObject = *It;
+		}
+		else
+		{
+			for (UActorComponent * Component : It->GetComponents())
+			{
+				if (Component && Component->GetName() == ComponentName)
+				{
+					FoundObject = Component;
+					break;
+				}
+			}
+		}
+		break;
+	}
+
+	if (FoundObject)
+		ResolvedObjects.Add(NameIndex, FoundObject);
+	else
+		++MissingObjects;
+
+	return FoundObject;
+}
+
+void FVRGripJournalReplay::ApplyRecord(const FVRGripJournalRecord & Record)
+{
+	UObject * Owner = FindJournalObject(Record.ControllerName);
+
+	// Cameras only have poses
+	if (Record.Type == EVRGripJournalRecordType::ControllerPose)
+	{
+		if (USceneComponent * SceneComponent = Cast<USceneComponent>(Owner))
+		{
+			// No tracking in a headless world, let the controller tick its grips off of the journal pose
+			if (UGripMotionControllerComponent * PoseController = Cast<UGripMotionControllerComponent>(SceneComponent))
+				PoseController->bUseWithoutTracking = true;
+
+			SceneComponent->SetRelativeLocationAndRotation(Record.Location, Record.Rotation);
+		}
+		return;
+	}
+
+	UGripMotionControllerComponent * Controller = Cast<UGripMotionControllerComponent>(Owner);
+
+	if (!Controller)
+		return;
+
+	switch (Record.Type)
+	{
+	case EVRGripJournalRecordType::Grip:
+	{
+		if (UObject * Object = FindJournalObject(Record.ObjectName))
+		{
+			Controller->GripObject(
+				Object,
+				FTransform(Record.Rotation, Record.Location),
+				true,
+				NAME_None,
+				NAME_None,
+				(EGripCollisionType)Record.GripCollisionType,
+				(EGripLateUpdateSettings)Record.GripLateUpdateSetting,
+				(EGripMovementReplicationSettings)Record.GripMovementReplicationSetting,
+				Record.Stiffness,
+				Record.Damping
+			);
+		}
+	}break;
+
+	case EVRGripJournalRecordType::Drop:
+	{
+		if (UObject * Object = FindJournalObject(Record.ObjectName))
+		{
+			Controller->DropObject(Object, 0, Record.bSimulate);
+		}
+	}break;
+
+	// Replication events happen on their own in the replay, they are only in the journal for reference
+	case EVRGripJournalRecordType::GripReplication:
+	default:break;
+	}
+}
+
+void FVRGripJournalReplay::Finish()
+{
+	if (bFinished)
+		return;
+
+	bFinished = true;
+
+	const int32 TimedFrames = FMath::Max(FramesPlayed - 1, 1);
+	UE_LOG(LogVRGripJournal, Log, TEXT("Grip journal replay finished: %d frames, %d records, avg frame %.3fms, max frame %.3fms, %d unresolved names"),
+		FramesPlayed, NextRecord, (TotalFrameTime / TimedFrames) * 1000.0, MaxFrameTime * 1000.0, MissingObjects);
+
+	OnReplayFinished.ExecuteIfBound();
+
+	if (bExitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+namespace VRGripJournalCommands
+{
+	static TUniquePtr<FVRGripJournalReplay> ActiveReplay;
+	static FDelegateHandle WorldCleanupHandle;
+
+	static void ReleaseReplay()
+	{
+		ActiveReplay.Reset();
+
+		if (WorldCleanupHandle.IsValid())
+		{
+			FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+			WorldCleanupHandle.Reset();
+		}
+	}
+
+	static void OnWorldCleanup(UWorld * World, bool bSessionEnded, bool bCleanupResources)
+	{
+		if (ActiveReplay.IsValid() && (!ActiveReplay->GetReplayWorld() || ActiveReplay->GetReplayWorld() == World))
+			ReleaseReplay();
+	}
+
+	static void OnReplayFinished()
+	{
+		// Free it next frame, we are still inside of the replays tick here
+		FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float DeltaTime)
+		{
+			if (ActiveReplay.IsValid() && ActiveReplay->IsFinished())
+				ReleaseReplay();
+
+			return false;
+		}));
+	}
+
+	static void StartJournal(const TArray<FString>& Args)
+	{
+		const int32 MaxRecords = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 65536;
+		FVRGripJournal::Get().StartRecording(MaxRecords);
+		UE_LOG(LogVRGripJournal, Log, TEXT("Grip journal recording started, ring size %d records"), FMath::Max(MaxRecords, 1));
+	}
+
+	static void StopJournal(const TArray<FString>& Args)
+	{
+		if (!FVRGripJournal::IsRecording())
+		{
+			UE_LOG(LogVRGripJournal, Warning, TEXT("Grip journal is not recording"));
+			return;
+		}
+
+		FVRGripJournal::Get().StopRecording(Args.Num() > 0 ? Args[0] : FVRGripJournal::GetDefaultFilePath());
+	}
+
+	static void ReplayJournal(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+			return;
+
+		TArray<FString> Names;
+		TArray<FVRGripJournalRecord> Records;
+
+		const FString FilePath = Args.Num() > 0 ? Args[0] : FVRGripJournal::GetDefaultFilePath();
+		if (!FVRGripJournal::LoadFromFile(FilePath, Names, Records))
+			return;
+
+		const bool bExitWhenDone = Args.Num() > 1 && FCString::Atoi(*Args[1]) != 0;
+
+		UE_LOG(LogVRGripJournal, Log, TEXT("Replaying %d grip journal records from %s"), Records.Num(), *FilePath);
+		ReleaseReplay();
+		ActiveReplay = MakeUnique<FVRGripJournalReplay>(World, MoveTemp(Names), MoveTemp(Records), bExitWhenDone);
+		ActiveReplay->OnReplayFinished.BindStatic(&OnReplayFinished);
+		WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnWorldCleanup);
+	}
+
+	static FAutoConsoleCommand CmdStartJournal(
+		TEXT("vr.GripJournal.Start"),
+		TEXT("Starts recording controller poses and grip events into the grip journal.\n")
+		TEXT("Usage: vr.GripJournal.Start [MaxRecords]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&StartJournal));
+
+	static FAutoConsoleCommand CmdStopJournal(
+		TEXT("vr.GripJournal.Stop"),
+		TEXT("Stops recording the grip journal and writes it to disk, defaults to Saved/GripJournals/GripJournal.vrgj.\n")
+		TEXT("Usage: vr.GripJournal.Stop [FilePath]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&StopJournal));
+
+	static FAutoConsoleCommand CmdReplayJournal(
+		TEXT("vr.GripJournal.Replay"),
+		TEXT("Plays a grip journal back into the current world without an HMD and logs frame timings when done.\n")
+		TEXT("Usage: vr.GripJournal.Replay [FilePath] [ExitWhenDone]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ReplayJournal));
+}
@@ -0,0 +1,279 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRMovementProfiler.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+DEFINE_LOG_CATEGORY(LogVRMovementProfiler);
+
+int32 FVRMovementProfiler::bEnabled = 0;
+
+double FVRMovementProfiler::FPhaseStats::GetWindowTotal() const
+{
+	double Total = 0.0;
+	for (int32 i = 0; i < WindowFrames; ++i)
+	{
+		Total += Window[i];
+	}
+
+	return Total;
+}
+
+double FVRMovementProfiler::FCharacterStats::GetWindowAverage() const
+{
+	if (WindowCount < 1 || IsStale())
+		return 0.0;
+
+	// Phases are inclusive, PhysWalking and the server checks are the outer most so they are what the character actually costs
+	const double Total = Phases[(int32)EVRMovementPhase::PhysWalking].GetWindowTotal() +
+		Phases[(int32)EVRMovementPhase::ServerCheckClientError].GetWindowTotal() +
+		Phases[(int32)EVRMovementPhase::SmoothCorrection].GetWindowTotal();
+
+	return Total / WindowCount;
+}
+
+double FVRMovementProfiler::FCharacterStats::GetPhaseWindowAverage(int32 PhaseIndex) const
+{
+	if (WindowCount < 1 || IsStale())
+		return 0.0;
+
+	return Phases[PhaseIndex].GetWindowTotal() / WindowCount;
+}
+
+FVRMovementProfiler & FVRMovementProfiler::Get()
+{
+	static FVRMovementProfiler Profiler;
+	return Profiler;
+}
+
+const TCHAR * FVRMovementProfiler::GetPhaseName(EVRMovementPhase Phase)
+{
+	switch (Phase)
+	{
+	case EVRMovementPhase::PhysWalking: return TEXT("PhysWalking");
+	case EVRMovementPhase::FindFloor: return TEXT("FindFloor");
+	case EVRMovementPhase::StepUp: return TEXT("StepUp");
+	case EVRMovementPhase::MoveAlongFloor: return TEXT("MoveAlongFloor");
+	case EVRMovementPhase::ServerCheckClientError: return TEXT("ServerCheckClientErrorVR");
+	case EVRMovementPhase::SmoothCorrection: return TEXT("SmoothCorrection");
+	default: return TEXT("Unknown");
+	}
+}
+
+void FVRMovementProfiler::AddSample(const UObject * Component, EVRMovementPhase Phase, uint64 Cycles)
+{
+	if (!Component || Phase >= EVRMovementPhase::Count)
+		return;
+
+	const FObjectKey ComponentKey(Component);
+	FCharacterStats * FoundStats = Characters.Find(ComponentKey);
+
+	// Only clean up when a new character shows up, that is when respawns would otherwise pile up
+	if (!FoundStats)
+	{
+		RemoveStaleCharacters();
+		FoundStats = &Characters.Add(ComponentKey);
+	}
+
+	FCharacterStats & Stats = *FoundStats;
+
+	if (Stats.Name.IsEmpty())
+	{
+		const UObject * Outer = Component->GetOuter();
+		Stats.Name = Outer ? Outer->GetName() : Component->GetName();
+	}
+
+	// New frame, push last frames costs into the rolling window
+	if (Stats.LastFrame != GFrameCounter)
+	{
+		if (Stats.LastFrame != 0)
+		{
+			for (FPhaseStats & PhaseStats : Stats.Phases)
+			{
+				PhaseStats.Window[Stats.WindowIndex] = (float)PhaseStats.FrameSeconds;
+				PhaseStats.FrameSeconds = 0.0;
+			}
+
+			Stats.WindowIndex = (Stats.WindowIndex + 1) % WindowFrames;
+			Stats.WindowCount = FMath::Min(Stats.WindowCount + 1, WindowFrames);
+		}
+
+		Stats.LastFrame = GFrameCounter;
+	}
+
+	const double Seconds = FPlatformTime::ToSeconds64(Cycles);
+	FPhaseStats & PhaseStats = Stats.Phases[(int32)Phase];
+
+	PhaseStats.Calls++;
+	PhaseStats.TotalSeconds += Seconds;
+	PhaseStats.FrameSeconds += Seconds;
+	PhaseStats.MaxSeconds = FMath::Max(PhaseStats.MaxSeconds, Seconds);
+
+	const uint32 Microseconds = (uint32)FMath::Min(Seconds * 1000000.0, (double)MAX_uint32);
+	const int32 Bucket = FMath::Min(Microseconds > 0 ? (int32)FMath::FloorLog2(Microseconds) + 1 : 0, HistogramBuckets - 1);
+	PhaseStats.Histogram[Bucket]++;
+}
+
+void FVRMovementProfiler::Reset()
+{
+	Characters.Reset();
+}
+
+void FVRMovementProfiler::RemoveStaleCharacters()
+{
+	for (auto It = Characters.CreateIterator(); It; ++It)
+	{
+		if (It.Value().IsStale())
+			It.RemoveCurrent();
+	}
+}
+
+void FVRMovementProfiler::Dump(int32 TopN) const
+{
+	if (!Characters.Num())
+	{
+		UE_LOG(LogVRMovementProfiler, Log, TEXT("No movement profile samples, enable with vre.MovementProfiler 1"));
+		return;
+	}
+
+	TArray<const FCharacterStats*> Sorted;
+	for (const TPair<FObjectKey, FCharacterStats> & Pair : Characters)
+	{
+		Sorted.Add(&Pair.Value);
+	}
+
+	Sorted.Sort([](const FCharacterStats & A, const FCharacterStats & B)
+	{
+		return A.GetWindowAverage() > B.GetWindowAverage();
+	});
+
+	double PhaseTotals[(int32)EVRMovementPhase::Count] = { 0.0 };
+	for (const FCharacterStats * Stats : Sorted)
+	{
+		for (int32 PhaseIndex = 0; PhaseIndex < (int32)EVRMovementPhase::Count; ++PhaseIndex)
+		{
+			PhaseTotals[PhaseIndex] += Stats->Phases[PhaseIndex].TotalSeconds;
+		}
+	}
+
+	UE_LOG(LogVRMovementProfiler, Log, TEXT("Movement profile, %d characters, top %d by rolling cost:"), Sorted.Num(), FMath::Min(TopN, Sorted.Num()));
+
+	for (int32 i = 0; i < Sorted.Num() && i < TopN; ++i)
+	{
+		const FCharacterStats & Stats = *Sorted[i];
+		UE_LOG(LogVRMovementProfiler, Log, TEXT("  %s: %.3fms/frame"), *Stats.Name, Stats.GetWindowAverage() * 1000.0);
+
+		for (int32 PhaseIndex = 0; PhaseIndex < (int32)EVRMovementPhase::Count; ++PhaseIndex)
+		{
+			const FPhaseStats & PhaseStats = Stats.Phases[PhaseIndex];
+			if (!PhaseStats.Calls)
+				continue;
+
+			UE_LOG(LogVRMovementProfiler, Log, TEXT("    %-26s %.3fms/frame, %llu calls, avg %.1fus, max %.1fus"),
+				GetPhaseName((EVRMovementPhase)PhaseIndex),
+				Stats.GetPhaseWindowAverage(PhaseIndex) * 1000.0,
+				PhaseStats.Calls,
+				(PhaseStats.TotalSeconds / PhaseStats.Calls) * 1000000.0,
+				PhaseStats.MaxSeconds * 1000000.0);
+		}
+	}
+
+	UE_LOG(LogVRMovementProfiler, Log, TEXT("Phase totals across all characters (inclusive):"));
+	for (int32 PhaseIndex = 0; PhaseIndex < (int32)EVRMovementPhase::Count; ++PhaseIndex)
+	{
+		UE_LOG(LogVRMovementProfiler, Log, TEXT("  %-26s %.3fms"), GetPhaseName((EVRMovementPhase)PhaseIndex), PhaseTotals[PhaseIndex] * 1000.0);
+	}
+}
+
+bool FVRMovementProfiler::ExportCSV(const FString & FilePath) const
+{
+	FString Output = TEXT("Character,Phase,Calls,TotalMs,AvgUs,MaxUs,RollingMsPerFrame");
+	for (int32 Bucket = 0; Bucket < HistogramBuckets; ++Bucket)
+	{
+		// Bucket 0 is under a microsecond, bucket N is under 2^N microseconds
+		Output += FString::Printf(TEXT(",Under%dus"), 1 << Bucket);
+	}
+	Output += LINE_TERMINATOR;
+
+	for (const TPair<FObjectKey, FCharacterStats> & Pair : Characters)
+	{
+		const FCharacterStats & Stats = Pair.Value;
+		for (int32 PhaseIndex = 0; PhaseIndex < (int32)EVRMovementPhase::Count; ++PhaseIndex)
+		{
+			const FPhaseStats & PhaseStats = Stats.Phases[PhaseIndex];
+			if (!PhaseStats.Calls)
+				continue;
+
+			Output += FString::Printf(TEXT("%s,%s,%llu,%.4f,%.2f,%.2f,%.4f"),
+				*Stats.Name,
+				GetPhaseName((EVRMovementPhase)PhaseIndex),
+				PhaseStats.Calls,
+				PhaseStats.TotalSeconds * 1000.0,
+				(PhaseStats.TotalSeconds / PhaseStats.Calls) * 1000000.0,
+				PhaseStats.MaxSeconds * 1000000.0,
+				Stats.GetPhaseWindowAverage(PhaseIndex) * 1000.0);
+
+			for (int32 Bucket = 0; Bucket < HistogramBuckets; ++Bucket)
+			{
+				Output += FString::Printf(TEXT(",%u"), PhaseStats.Histogram[Bucket]);
+			}
+			Output += LINE_TERMINATOR;
+		}
+	}
+
+	if (!FFileHelper::SaveStringToFile(Output, *FilePath))
+	{
+		UE_LOG(LogVRMovementProfiler, Warning, TEXT("Failed to write movement profile to %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogVRMovementProfiler, Log, TEXT("Wrote movement profile for %d characters to %s"), Characters.Num(), *FilePath);
+	return true;
+}
+
+namespace VRMovementProfilerCommands
+{
+	FAutoConsoleVariableRef CVarMovementProfiler(
+		TEXT("vre.MovementProfiler"),
+		FVRMovementProfiler::bEnabled,
+		TEXT("Records per character, per phase timings for the VR character movement.\n")
+		TEXT("0: Disabled (default), 1: Enabled"),
+		ECVF_Default);
+
+	static void DumpProfile(const TArray<FString>& Args)
+	{
+		FVRMovementProfiler::Get().Dump(Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 10);
+	}
+
+	static void ExportProfile(const TArray<FString>& Args)
+	{
+		const FString FilePath = Args.Num() > 0 ? Args[0] :
+			FPaths::ProfilingDir() / TEXT("VRMovement") / FString::Printf(TEXT("MovementProfile-%s.csv"), *FDateTime::Now().ToString());
+
+		FVRMovementProfiler::Get().ExportCSV(FilePath);
+	}
+
+	static void ResetProfile(const TArray<FString>& Args)
+	{
+		FVRMovementProfiler::Get().Reset();
+	}
+
+	static FAutoConsoleCommand CmdDumpProfile(
+		TEXT("vre.MovementProfiler.Dump"),
+		TEXT("Logs the most expensive VR characters and their movement phases.\n")
+		TEXT("Usage: vre.MovementProfiler.Dump [TopN]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&DumpProfile));
+
+	static FAutoConsoleCommand CmdExportProfile(
+		TEXT("vre.MovementProfiler.CSV"),
+		TEXT("Writes the movement profile out as a CSV, defaults to Saved/Profiling/VRMovement.\n")
+		TEXT("Usage: vre.MovementProfiler.CSV [FilePath]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&ExportProfile));
+
+	static FAutoConsoleCommand CmdResetProfile(
+		TEXT("vre.MovementProfiler.Reset"),
+		TEXT("Clears all recorded movement profile samples."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&ResetProfile));
+}
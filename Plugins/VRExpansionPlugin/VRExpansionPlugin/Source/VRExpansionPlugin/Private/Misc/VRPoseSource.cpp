@@ -0,0 +1,187 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRPoseSource.h"
+#include "Components/SceneComponent.h"
+#include "Misc/Paths.h"
+
+bool UVRPoseSource::GetPose_Implementation(USceneComponent * Target, float DeltaTime, FVector & Position, FRotator & Orientation)
+{
+	return false;
+}
+
+UVRPoseSource_Procedural::UVRPoseSource_Procedural(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	Mode = EVRProceduralPoseMode::RandomWalk;
+	Origin = FVector::ZeroVector;
+	OriginRotation = FRotator::ZeroRotator;
+	WalkRadius = 30.0f;
+	WalkSpeed = 40.0f;
+	TurnSpeed = 60.0f;
+	SweepYawRange = 60.0f;
+	SweepPitchRange = 20.0f;
+	SweepPeriod = 2.0f;
+	Seed = 0;
+
+	bInitialized = false;
+	ElapsedTime = 0.0f;
+	WalkOffset = FVector::ZeroVector;
+	WalkVelocity = FVector::ZeroVector;
+	WalkRotation = FRotator::ZeroRotator;
+}
+
+bool UVRPoseSource_Procedural::GetPose_Implementation(USceneComponent * Target, float DeltaTime, FVector & Position, FRotator & Orientation)
+{
+	if (!bInitialized)
+	{
+		Stream.Initialize(Seed != 0 ? Seed : FMath::Rand());
+		bInitialized = true;
+	}
+
+	ElapsedTime += DeltaTime;
+
+	switch (Mode)
+	{
+	case EVRProceduralPoseMode::AimSweep:
+	{
+		const float YawAlpha = FMath::Sin(2.0f * PI * ElapsedTime / SweepPeriod);
+		const float PitchAlpha = FMath::Sin(2.0f * PI * ElapsedTime / (SweepPeriod * 1.618f));
+
+		Position = Origin;
+		Orientation = OriginRotation + FRotator(PitchAlpha * SweepPitchRange, YawAlpha * SweepYawRange, 0.0f);
+	}break;
+
+	case EVRProceduralPoseMode::RandomWalk:
+	default:
+	{
+		// Random acceleration, capped speed
+		WalkVelocity += Stream.GetUnitVector() * (WalkSpeed * 4.0f * DeltaTime);
+		WalkVelocity = WalkVelocity.GetClampedToMaxSize(WalkSpeed);
+		WalkOffset += WalkVelocity * DeltaTime;
+
+		// Bounce off of the edge of the walk radius
+		const float OffsetSize = WalkOffset.Size();
+		if (OffsetSize > WalkRadius && OffsetSize > KINDA_SMALL_NUMBER)
+		{
+			const FVector Normal = WalkOffset / OffsetSize;
+			WalkOffset = Normal * WalkRadius;
+			WalkVelocity -= 2.0f * (WalkVelocity | Normal) * Normal;
+		}
+
+		const float MaxTurn = TurnSpeed * DeltaTime;
+		WalkRotation.Yaw = FMath::Clamp(WalkRotation.Yaw + Stream.FRandRange(-MaxTurn, MaxTurn), -90.0f, 90.0f);
+		WalkRotation.Pitch = FMath::Clamp(WalkRotation.Pitch + Stream.FRandRange(-MaxTurn, MaxTurn), -60.0f, 60.0f);
+
+		Position = Origin + WalkOffset;
+		Orientation = OriginRotation + WalkRotation;
+	}break;
+	}
+
+	return true;
+}
+
+UVRPoseSource_File::UVRPoseSource_File(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bLoop = true;
+	PlayRate = 1.0f;
+
+	bLoadAttempted = false;
+	PlaybackTime = 0.0f;
+	Cursor = 0;
+}
+
+void UVRPoseSource_File::ResetPlayback()
+{
+	Poses.Reset();
+	bLoadAttempted = false;
+	PlaybackTime = 0.0f;
+	Cursor = 0;
+}
+
+bool UVRPoseSource_File::LoadTrack(USceneComponent * Target)
+{
+	FString FullPath = FilePath.IsEmpty() ? FVRGripJournal::GetDefaultFilePath() : FilePath;
+	if (FPaths::IsRelative(FullPath))
+		FullPath = FPaths::ProjectSavedDir() / FullPath;
+
+	TArray<FString> Names;
+	TArray<FVRGripJournalRecord> Records;
+
+	if (!FVRGripJournal::LoadFromFile(FullPath, Names, Records))
+		return false;
+
+	const FString WantedName = TrackName.IsEmpty() ? FVRGripJournal::GetJournalName(Target) : TrackName;
+	int32 TrackIndex = Names.Find(WantedName);
+
+	for (const FVRGripJournalRecord & Record : Records)
+	{
+		if (Record.Type != EVRGripJournalRecordType::ControllerPose)
+			continue;
+
+		// Nothing matched the name, take the first track that has poses
+		if (TrackIndex == INDEX_NONE)
+			TrackIndex = Record.ControllerName;
+
+		if (Record.ControllerName == TrackIndex)
+			Poses.Add(Record);
+	}
+
+	if (!Poses.Num())
+	{
+		UE_LOG(LogVRGripJournal, Warning, TEXT("No poses found for %s in %s"), *WantedName, *FullPath);
+		return false;
+	}
+
+	// Make the track start at zero
+	const float StartTime = Poses[0].WorldTime;
+	for (FVRGripJournalRecord & Pose : Poses)
+	{
+		Pose.WorldTime -= StartTime;
+	}
+
+	return true;
+}
+
+bool UVRPoseSource_File::GetPose_Implementation(USceneComponent * Target, float DeltaTime, FVector & Position, FRotator & Orientation)
+{
+	if (!bLoadAttempted)
+	{
+		bLoadAttempted = true;
+		LoadTrack(Target);
+	}
+
+	if (!Poses.Num())
+		return false;
+
+	PlaybackTime += DeltaTime * PlayRate;
+
+	const float TrackLength = Poses.Last().WorldTime;
+	if (PlaybackTime > TrackLength)
+	{
+		if (!bLoop || TrackLength <= 0.0f)
+		{
+			Position = Poses.Last().Location;
+			Orientation = Poses.Last().Rotation.Rotator();
+			return true;
+		}
+
+		PlaybackTime = FMath::Fmod(PlaybackTime, TrackLength);
+		Cursor = 0;
+	}
+
+	while (Cursor + 1 < Poses.Num() && Poses[Cursor + 1].WorldTime <= PlaybackTime)
+	{
+		++Cursor;
+	}
+
+	const FVRGripJournalRecord & From = Poses[Cursor];
+	const FVRGripJournalRecord & To = Poses[FMath::Min(Cursor + 1, Poses.Num() - 1)];
+
+	const float Span = To.WorldTime - From.WorldTime;
+	const float Alpha = Span > KINDA_SMALL_NUMBER ? FMath::Clamp((PlaybackTime - From.WorldTime) / Span, 0.0f, 1.0f) : 0.0f;
+
+	Position = FMath::Lerp(From.Location, To.Location, Alpha);
+	Orientation = FQuat::Slerp(From.Rotation, To.Rotation, Alpha).Rotator();
+	return true;
+}
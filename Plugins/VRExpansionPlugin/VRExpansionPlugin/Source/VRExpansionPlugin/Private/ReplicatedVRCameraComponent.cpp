@@ -7,6 +7,8 @@
 #include "IXRCamera.h"
 #include "VRBaseCharacter.h"
 #include "IHeadMountedDisplay.h"
+#include "Misc/VRGripJournal.h"
+#include "Misc/VRPoseSource.h"
 
 
 UReplicatedVRCameraComponent::UReplicatedVRCameraComponent(const FObjectInitializer& ObjectInitializer)
@@ -28,11 +30,17 @@ UReplicatedVRCameraComponent::UReplicatedVRCameraComponent(const FObjectInitiali
 	bOffsetByHMD = false;
 
 	bSetPositionDuringTick = false;
+	PoseSource = nullptr;
 	bSmoothReplicatedMotion = false;
+	bUseJitterBuffer = false;
+	JitterBufferPlayoutDelay = 0.05f;
+	MaxExtrapolationTime = 0.1f;
+	RemoteSampleTimeStamp = -1.0f;
 	bLerpingPosition = false;
 	bReppedOnce = false;
 
 	OverrideSendTransform = nullptr;
+	bReplicatesWithOwnerPose = false;
 
 	//bUseVRNeckOffset = true;
 	//VRNeckOffset = FTransform(FRotator::ZeroRotator, FVector(15.0f,0,0), FVector(1.0f));
@@ -55,19 +63,22 @@ void UReplicatedVRCameraComponent::GetLifetimeReplicatedProps(TArray< class FLif
 	//DOREPLIFETIME(UReplicatedVRCameraComponent, bReplicateTransform);
 }
 
-// Just skipping this, it generates warnings for attached meshes when using this method of denying transform replication
-/*void UReplicatedVRCameraComponent::PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker)
+void UReplicatedVRCameraComponent::PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker)
 {
 	Super::PreReplication(ChangedPropertyTracker);
 
-	// Don't ever replicate these, they are getting replaced by my custom send anyway
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, false);
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, false);
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, false);
-}*/
+	// The owning character replicates this as part of its pose instead
+	// Only our own property is toggled here, overriding the scene component relative transform properties
+	// generates warnings for attached meshes, those are skipped in GetLifetimeReplicatedProps instead
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UReplicatedVRCameraComponent, ReplicatedCameraTransform, !bReplicatesWithOwnerPose);
+}
 
 void UReplicatedVRCameraComponent::Server_SendCameraTransform_Implementation(FBPVRComponentPosRep NewTransform)
 {
+	// Based on a keyframe that never arrived, wait for the next one
+	if (!NetDeltaState.Decode(NewTransform))
+		return;
+
 	// Store new transform and trigger OnRep_Function
 	ReplicatedCameraTransform = NewTransform;
 
@@ -78,6 +89,12 @@ void UReplicatedVRCameraComponent::Server_SendCameraTransform_Implementation(FBP
 	}
 }
 
+void UReplicatedVRCameraComponent::AddNetSmoothingSample()
+{
+	const float LocalTime = GetWorld()->GetTimeSeconds();
+	NetSmoothingBuffer.AddSample(RemoteSampleTimeStamp >= 0.0f ? RemoteSampleTimeStamp : LocalTime, LocalTime, ReplicatedCameraTransform);
+}
+
 bool UReplicatedVRCameraComponent::Server_SendCameraTransform_Validate(FBPVRComponentPosRep NewTransform)
 {
 	return true;
@@ -114,8 +131,23 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 	// Don't do any of the below if we aren't the authority
 	if (bHasAuthority)
 	{
+		if (PoseSource)
+		{
+			FVector Position;
+			FRotator Orientation;
+			if (PoseSource->GetPose(this, DeltaTime, Position, Orientation))
+			{
+				if (bOffsetByHMD)
+				{
+					Position.X = 0;
+					Position.Y = 0;
+				}
+
+				SetRelativeTransform(FTransform(Orientation, Position));
+			}
+		}
 		// For non view target positional updates (third party and the like)
-		if (bSetPositionDuringTick && bLockToHmd && GEngine->XRSystem.IsValid() && GEngine->XRSystem->IsHeadTrackingAllowed())
+		else if (bSetPositionDuringTick && bLockToHmd && GEngine->XRSystem.IsValid() && GEngine->XRSystem->IsHeadTrackingAllowed())
 		{
 			//ResetRelativeTransform();
 			FQuat Orientation;
@@ -132,8 +164,11 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 			}
 		}
 
-		// Send changes
-		if (bReplicates)
+		if (FVRGripJournal::IsRecording())
+			FVRGripJournal::Get().RecordPose(this);
+
+		// Send changes, the owning character handles it if we are part of its combined pose
+		if (bReplicates && !bReplicatesWithOwnerPose)
 		{
 			// Don't rep if no changes
 			if (!this->RelativeLocation.Equals(ReplicatedCameraTransform.Position) ||  !this->RelativeRotation.Equals(ReplicatedCameraTransform.Rotation))
@@ -149,6 +184,8 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 
 					if (GetNetMode() == NM_Client)
 					{
+						NetDeltaState.Encode(ReplicatedCameraTransform);
+
 						AVRBaseCharacter * OwningChar = Cast<AVRBaseCharacter>(GetOwner());
 						if (OverrideSendTransform != nullptr && OwningChar != nullptr)
 						{
@@ -167,7 +204,15 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 	}
 	else
 	{
-		if (bLerpingPosition)
+		if (bSmoothReplicatedMotion && bUseJitterBuffer)
+		{
+			FVector SmoothedPosition;
+			FRotator SmoothedRotation;
+
+			if (NetSmoothingBuffer.Evaluate(GetWorld()->GetTimeSeconds(), JitterBufferPlayoutDelay, MaxExtrapolationTime, SmoothedPosition, SmoothedRotation))
+				SetRelativeLocationAndRotation(SmoothedPosition, SmoothedRotation);
+		}
+		else if (bLerpingPosition)
 		{
 			NetUpdateCount += DeltaTime;
 			float LerpVal = FMath::Clamp(NetUpdateCount / (1.0f / NetUpdateRate), 0.0f, 1.0f);
@@ -208,7 +253,8 @@ void UReplicatedVRCameraComponent::GetCameraView(float DeltaTime, FMinimalViewIn
 			bLockToHmd = false;
 	}
 
-	if (bIsLocallyControlled && GEngine && GEngine->XRSystem.IsValid() && GetWorld() && GetWorld()->WorldType != EWorldType::Editor)
+	// Pose sources set the transform in tick, don't let the HMD fight them
+	if (!PoseSource && bIsLocallyControlled && GEngine && GEngine->XRSystem.IsValid() && GetWorld() && GetWorld()->WorldType != EWorldType::Editor)
 	{
 		IXRTrackingSystem* XRSystem = GEngine->XRSystem.Get();
 		auto XRCamera = XRSystem->GetXRCamera();
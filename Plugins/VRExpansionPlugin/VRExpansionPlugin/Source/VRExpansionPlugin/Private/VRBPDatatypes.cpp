@@ -1,6 +1,10 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "VRBPDataTypes.h"
+#include "Serialization/BitWriter.h"
+#include "Serialization/BitReader.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVRDataTypes, Log, All);
 
 namespace VRDataTypeCVARs
 {
@@ -13,6 +17,16 @@ namespace VRDataTypeCVARs
 		TEXT("When on, will rep Quantized transforms at full precision, WARNING use at own risk, if this isn't the same setting client & server then it will crash.\n")
 		TEXT("0: Disable, 1: Enable"),
 		ECVF_Default);
+
+	static int32 PosRepKeyframeInterval = 10;
+	FAutoConsoleVariableRef CVarPosRepKeyframeInterval(
+		TEXT("vrexp.PosRepKeyframeInterval"),
+		PosRepKeyframeInterval,
+		TEXT("Number of delta sends between full keyframes for component reps using the DeltaOneDecimal quantization level.\n")
+		TEXT("Deltas are encoded against the last keyframe, not the last acknowledged send, so if a keyframe is lost the receiver\n")
+		TEXT("drops every delta based on it and holds its last position until the next keyframe (up to this many sends).\n")
+		TEXT("Lower recovers from packet loss faster, higher saves more bandwidth. Default: 10"),
+		ECVF_Default);
 }
 
 bool FTransform_NetQuantize::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
@@ -89,4 +103,440 @@ bool FTransform_NetQuantize::NetSerialize(FArchive& Ar, class UPackageMap* Map,
 	}
 
 	return bOutSuccess;
-}
\ No newline at end of file
+}
+
+void FBPVRComponentPosRep::SerializeSmallestThreeRotation(FArchive& Ar, FRotator & InOutRotation)
+{
+	// The three smallest components of a unit quat can never be larger than 1 / sqrt(2)
+	const float MaxComponent = 0.707107f;
+	const uint32 MaxQuantized = (1 << 10) - 1;
+
+	uint32 LargestIndex = 0;
+	uint32 Quantized[3] = { 0, 0, 0 };
+
+	if (Ar.IsSaving())
+	{
+		FQuat Quat = InOutRotation.Quaternion();
+		Quat.Normalize();
+		const float Components[4] = { Quat.X, Quat.Y, Quat.Z, Quat.W };
+
+		for (uint32 i = 1; i < 4; ++i)
+		{
+			if (FMath::Abs(Components[i]) > FMath::Abs(Components[LargestIndex]))
+				LargestIndex = i;
+		}
+
+		// Q and -Q are the same rotation, flip it so the dropped component is always positive
+		const float Sign = Components[LargestIndex] < 0.0f ? -1.0f : 1.0f;
+
+		int32 Slot = 0;
+		for (uint32 i = 0; i < 4; ++i)
+		{
+			if (i == LargestIndex)
+				continue;
+
+			const float Normalized = ((Components[i] * Sign) / MaxComponent) * 0.5f + 0.5f;
+			Quantized[Slot++] = (uint32)FMath::Clamp(FMath::RoundToInt(Normalized * MaxQuantized), 0, (int32)MaxQuantized);
+		}
+	}
+
+	Ar.SerializeBits(&LargestIndex, 2);
+	Ar.SerializeBits(&Quantized[0], 10);
+	Ar.SerializeBits(&Quantized[1], 10);
+	Ar.SerializeBits(&Quantized[2], 10);
+
+	if (Ar.IsLoading())
+	{
+		float Components[4];
+		float SumSquared = 0.0f;
+
+		int32 Slot = 0;
+		for (uint32 i = 0; i < 4; ++i)
+		{
+			if (i == LargestIndex)
+				continue;
+
+			Components[i] = (((float)Quantized[Slot++] / MaxQuantized) * 2.0f - 1.0f) * MaxComponent;
+			SumSquared += FMath::Square(Components[i]);
+		}
+
+		Components[LargestIndex] = FMath::Sqrt(FMath::Max(0.0f, 1.0f - SumSquared));
+
+		FQuat Quat(Components[0], Components[1], Components[2], Components[3]);
+		Quat.Normalize();
+		InOutRotation = Quat.Rotator();
+	}
+}
+
+// Zig zag encodes the delta so that small negatives also pack down, then writes all three at the width of the largest
+static void SerializeQuantizedDelta(FArchive& Ar, FIntVector & InOutDelta)
+{
+	uint32 ZigZag[3] = { 0, 0, 0 };
+
+	// Stored as width - 1, so 1 - 16 bits per component
+	uint32 WidthMinusOne = 0;
+
+	if (Ar.IsSaving())
+	{
+		for (int32 i = 0; i < 3; ++i)
+		{
+			ZigZag[i] = (uint32)((InOutDelta[i] << 1) ^ (InOutDelta[i] >> 31));
+		}
+
+		const uint32 Largest = ZigZag[0] | ZigZag[1] | ZigZag[2];
+		WidthMinusOne = FMath::Max<uint32>(32 - FMath::CountLeadingZeros(Largest), 1) - 1;
+	}
+
+	Ar.SerializeBits(&WidthMinusOne, 4);
+
+	for (int32 i = 0; i < 3; ++i)
+	{
+		Ar.SerializeBits(&ZigZag[i], WidthMinusOne + 1);
+	}
+
+	if (Ar.IsLoading())
+	{
+		for (int32 i = 0; i < 3; ++i)
+		{
+			InOutDelta[i] = (int32)(ZigZag[i] >> 1) ^ -(int32)(ZigZag[i] & 1);
+		}
+	}
+}
+
+bool FBPVRComponentPosRep::SerializeTransform(FArchive& Ar, EVRVectorQuantization InQuantizationLevel, EVRRotationQuantization InRotationQuantizationLevel)
+{
+	bool bOutSuccess = true;
+
+	if (InQuantizationLevel == EVRVectorQuantization::DeltaOneDecimal)
+	{
+		Ar.SerializeBits(&bIsKeyframe, 1);
+		Ar.SerializeBits(&KeyframeID, FBPVRPosRepDeltaState::KeyframeIDBits);
+
+		// Keyframes are the same as RoundOneDecimal so that the delta math lines up exactly on both ends
+		if (bIsKeyframe)
+			bOutSuccess &= SerializeQuantizedPosition(Ar, EVRVectorQuantization::RoundOneDecimal, Position);
+		else
+			SerializeQuantizedDelta(Ar, QuantizedDelta);
+	}
+	else
+	{
+		bOutSuccess &= SerializeQuantizedPosition(Ar, InQuantizationLevel, Position);
+	}
+
+	SerializeQuantizedRotation(Ar, InRotationQuantizationLevel, Rotation);
+
+	return bOutSuccess;
+}
+
+// Same rounding that SerializePackedVector<10, X> does
+static FORCEINLINE FIntVector QuantizeDeltaPosition(const FVector & Position)
+{
+	return FIntVector(FMath::RoundToInt(Position.X * 10.0f), FMath::RoundToInt(Position.Y * 10.0f), FMath::RoundToInt(Position.Z * 10.0f));
+}
+
+void FBPVRPosRepDeltaState::Encode(FBPVRComponentPosRep & InOutRep)
+{
+	if (InOutRep.QuantizationLevel != EVRVectorQuantization::DeltaOneDecimal)
+		return;
+
+	const FIntVector QuantizedPosition = QuantizeDeltaPosition(InOutRep.Position);
+	const FIntVector Delta = QuantizedPosition - KeyframePosition;
+	const int32 MaxDelta = (1 << (MaxDeltaBits - 1)) - 1;
+
+	const bool bNeedsKeyframe =
+		!bHasKeyframe ||
+		SamplesSinceKeyframe >= FMath::Max(VRDataTypeCVARs::PosRepKeyframeInterval, 1) ||
+		FMath::Abs(Delta.X) > MaxDelta || FMath::Abs(Delta.Y) > MaxDelta || FMath::Abs(Delta.Z) > MaxDelta;
+
+	if (bNeedsKeyframe)
+	{
+		KeyframeID = (KeyframeID + 1) & ((1 << KeyframeIDBits) - 1);
+		KeyframePosition = QuantizedPosition;
+		SamplesSinceKeyframe = 0;
+		bHasKeyframe = true;
+
+		InOutRep.bIsKeyframe = true;
+		InOutRep.QuantizedDelta = FIntVector::ZeroValue;
+	}
+	else
+	{
+		++SamplesSinceKeyframe;
+
+		InOutRep.bIsKeyframe = false;
+		InOutRep.QuantizedDelta = Delta;
+	}
+
+	InOutRep.KeyframeID = KeyframeID;
+}
+
+bool FBPVRPosRepDeltaState::Decode(FBPVRComponentPosRep & InOutRep)
+{
+	if (InOutRep.QuantizationLevel != EVRVectorQuantization::DeltaOneDecimal)
+		return true;
+
+	if (InOutRep.bIsKeyframe)
+	{
+		KeyframePosition = QuantizeDeltaPosition(InOutRep.Position);
+		KeyframeID = InOutRep.KeyframeID;
+		bHasKeyframe = true;
+		return true;
+	}
+
+	// Lost the keyframe this is based on, wait for the next one
+	if (!bHasKeyframe || InOutRep.KeyframeID != KeyframeID)
+		return false;
+
+	const FIntVector Resolved = KeyframePosition + InOutRep.QuantizedDelta;
+	InOutRep.Position = FVector(Resolved.X, Resolved.Y, Resolved.Z) / 10.0f;
+	InOutRep.bIsKeyframe = true;
+
+	return true;
+}
+
+void FBPVRPosRepJitterBuffer::AddSample(float RemoteTimeStamp, float LocalTime, const FBPVRComponentPosRep & Rep)
+{
+	// Snap down to a faster path right away, but only drift back up slowly so a single late packet doesn't shift playback
+	const float Offset = LocalTime - RemoteTimeStamp;
+	if (!bHasClockOffset || Offset < ClockOffset)
+	{
+		ClockOffset = Offset;
+		bHasClockOffset = true;
+	}
+	else
+	{
+		ClockOffset = FMath::Lerp(ClockOffset, Offset, 0.01f);
+	}
+
+	// Unreliable sends can arrive out of order, keep it sorted
+	int32 Index = Samples.Num();
+	while (Index > 0 && Samples[Index - 1].TimeStamp >= RemoteTimeStamp)
+	{
+		--Index;
+	}
+
+	// Already have this one
+	if (Samples.IsValidIndex(Index) && Samples[Index].TimeStamp == RemoteTimeStamp)
+		return;
+
+	FSample NewSample;
+	NewSample.TimeStamp = RemoteTimeStamp;
+	NewSample.Position = Rep.Position;
+	NewSample.Rotation = Rep.Rotation.Quaternion();
+
+	// Keep the quats on the same hemisphere so the interpolation doesn't take the long way around
+	if (Index > 0)
+		NewSample.Rotation.EnforceShortestArcWith(Samples[Index - 1].Rotation);
+
+	Samples.Insert(NewSample, Index);
+
+	if (Samples.IsValidIndex(Index + 1))
+		Samples[Index + 1].Rotation.EnforceShortestArcWith(Samples[Index].Rotation);
+
+	if (Samples.Num() > MaxSamples)
+		Samples.RemoveAt(0, 1, false);
+}
+
+bool FBPVRPosRepJitterBuffer::Evaluate(float LocalTime, float PlayoutDelay, float MaxExtrapolationTime, FVector & OutPosition, FRotator & OutRotation)
+{
+	if (!Samples.Num())
+		return false;
+
+	const float PlaybackTime = LocalTime - ClockOffset - PlayoutDelay;
+
+	// Throw out samples that we are past, keeping one behind the current segment for its tangent
+	while (Samples.Num() > 3 && Samples[2].TimeStamp <= PlaybackTime)
+	{
+		Samples.RemoveAt(0, 1, false);
+	}
+
+	const FSample & Newest = Samples.Last();
+
+	// Ran out of samples, extrapolate off of the last two for a bit and then hold
+	if (PlaybackTime >= Newest.TimeStamp)
+	{
+		OutPosition = Newest.Position;
+		OutRotation = Newest.Rotation.Rotator();
+
+		if (Samples.Num() < 2)
+			return true;
+
+		const FSample & Previous = Samples[Samples.Num() - 2];
+		const float Interval = Newest.TimeStamp - Previous.TimeStamp;
+		const float ExtrapolationTime = FMath::Min(PlaybackTime - Newest.TimeStamp, MaxExtrapolationTime);
+
+		if (Interval > KINDA_SMALL_NUMBER && ExtrapolationTime > 0.0f)
+		{
+			const float Scale = ExtrapolationTime / Interval;
+			OutPosition += (Newest.Position - Previous.Position) * Scale;
+
+			FVector Axis;
+			float Angle;
+			(Newest.Rotation * Previous.Rotation.Inverse()).ToAxisAndAngle(Axis, Angle);
+			Angle = FMath::UnwindRadians(Angle);
+
+			OutRotation = (FQuat(Axis, Angle * Scale) * Newest.Rotation).Rotator();
+		}
+
+		return true;
+	}
+
+	// Haven't reached the first sample yet
+	if (PlaybackTime <= Samples[0].TimeStamp)
+	{
+		OutPosition = Samples[0].Position;
+		OutRotation = Samples[0].Rotation.Rotator();
+		return true;
+	}
+
+	int32 Index = 0;
+	while (Samples[Index + 1].TimeStamp < PlaybackTime)
+	{
+		++Index;
+	}
+
+	const FSample & Start = Samples[Index];
+	const FSample & End = Samples[Index + 1];
+	const FSample & BeforeStart = Samples[FMath::Max(Index - 1, 0)];
+	const FSample & AfterEnd = Samples[FMath::Min(Index + 2, Samples.Num() - 1)];
+
+	const float SegmentTime = FMath::Max(End.TimeStamp - Start.TimeStamp, KINDA_SMALL_NUMBER);
+	const float Alpha = FMath::Clamp((PlaybackTime - Start.TimeStamp) / SegmentTime, 0.0f, 1.0f);
+
+	// Velocity at each end from its neighbours, scaled into the segments alpha space
+	const FVector StartTangent = (End.Position - BeforeStart.Position) * (SegmentTime / FMath::Max(End.TimeStamp - BeforeStart.TimeStamp, KINDA_SMALL_NUMBER));
+	const FVector EndTangent = (AfterEnd.Position - Start.Position) * (SegmentTime / FMath::Max(AfterEnd.TimeStamp - Start.TimeStamp, KINDA_SMALL_NUMBER));
+
+	OutPosition = FMath::CubicInterp(Start.Position, StartTangent, End.Position, EndTangent, Alpha);
+
+	FQuat StartRotTangent;
+	FQuat EndRotTangent;
+	FQuat::CalcTangents(BeforeStart.Rotation, Start.Rotation, End.Rotation, 0.0f, StartRotTangent);
+	FQuat::CalcTangents(Start.Rotation, End.Rotation, AfterEnd.Rotation, 0.0f, EndRotTangent);
+
+	OutRotation = FQuat::Squad(Start.Rotation, StartRotTangent, End.Rotation, EndRotTangent, Alpha).Rotator();
+
+	return true;
+}
+
+namespace VRDataTypeCVARs
+{
+	// Runs a synthetic 90htz hand motion stream through each rep mode and logs bits per pose and the error it introduces
+	// vrexp.BenchmarkPosRepQuantization [NumSamples] [PacketLossPercent]
+	static void BenchmarkPosRepQuantization(const TArray<FString>& Args)
+	{
+		const int32 NumSamples = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 900, 1);
+		const float PacketLossPercent = Args.Num() > 1 ? FMath::Clamp(FCString::Atof(*Args[1]), 0.0f, 100.0f) : 0.0f;
+
+		// Slow reaching motion with wrist rotation and a little tremor on top, relative to the tracking origin
+		TArray<FVector> Positions;
+		TArray<FRotator> Rotations;
+		Positions.Reserve(NumSamples);
+		Rotations.Reserve(NumSamples);
+
+		FRandomStream Tremor(1234);
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			const float Time = i / 90.0f;
+			Positions.Add(FVector(
+				30.0f + 25.0f * FMath::Sin(Time * 1.7f),
+				-20.0f + 15.0f * FMath::Sin(Time * 2.3f + 1.0f),
+				110.0f + 10.0f * FMath::Sin(Time * 3.1f)) + Tremor.VRand() * 0.05f);
+			Rotations.Add(FRotator(
+				40.0f * FMath::Sin(Time * 1.3f),
+				90.0f * FMath::Sin(Time * 0.9f),
+				60.0f * FMath::Sin(Time * 2.1f)));
+		}
+
+		struct FRepMode
+		{
+			EVRVectorQuantization PositionLevel;
+			EVRRotationQuantization RotationLevel;
+			const TCHAR * Name;
+		};
+
+		const FRepMode Modes[] =
+		{
+			{ EVRVectorQuantization::RoundTwoDecimals, EVRRotationQuantization::RoundToShort, TEXT("TwoDecimals + Short (default)") },
+			{ EVRVectorQuantization::RoundOneDecimal, EVRRotationQuantization::RoundTo10Bits, TEXT("OneDecimal + 10Bits") },
+			{ EVRVectorQuantization::RoundTwoDecimals, EVRRotationQuantization::SmallestThree, TEXT("TwoDecimals + SmallestThree") },
+			{ EVRVectorQuantization::RoundOneDecimal, EVRRotationQuantization::SmallestThree, TEXT("OneDecimal + SmallestThree") },
+			{ EVRVectorQuantization::DeltaOneDecimal, EVRRotationQuantization::SmallestThree, TEXT("DeltaOneDecimal + SmallestThree") },
+		};
+
+		UE_LOG(LogVRDataTypes, Display, TEXT("PosRep quantization benchmark: %d samples @ 90htz, %.1f%% packet loss, keyframe interval %d"), NumSamples, PacketLossPercent, PosRepKeyframeInterval);
+
+		for (const FRepMode & Mode : Modes)
+		{
+			FBPVRPosRepDeltaState SenderState;
+			FBPVRPosRepDeltaState ReceiverState;
+			FRandomStream Loss(4321);
+
+			int64 TotalBits = 0;
+			double TotalPositionError = 0.0;
+			double TotalRotationError = 0.0;
+			float MaxPositionError = 0.0f;
+			float MaxRotationError = 0.0f;
+			int32 NumReceived = 0;
+			int32 NumLost = 0;
+			int32 NumDropped = 0;
+
+			for (int32 i = 0; i < NumSamples; ++i)
+			{
+				FBPVRComponentPosRep Sent;
+				Sent.QuantizationLevel = Mode.PositionLevel;
+				Sent.RotationQuantizationLevel = Mode.RotationLevel;
+				Sent.Position = Positions[i];
+				Sent.Rotation = Rotations[i];
+				SenderState.Encode(Sent);
+
+				bool bSuccess = true;
+				FBitWriter Writer(0, true);
+				Sent.NetSerialize(Writer, nullptr, bSuccess);
+				TotalBits += Writer.GetNumBits();
+
+				if (Loss.FRand() * 100.0f < PacketLossPercent)
+				{
+					++NumLost;
+					continue;
+				}
+
+				FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+				FBPVRComponentPosRep Received;
+				Received.NetSerialize(Reader, nullptr, bSuccess);
+
+				if (!ReceiverState.Decode(Received))
+				{
+					++NumDropped;
+					continue;
+				}
+
+				// cm to mm
+				const float PositionError = FVector::Dist(Received.Position, Positions[i]) * 10.0f;
+				const float RotationError = FMath::RadiansToDegrees(Received.Rotation.Quaternion().AngularDistance(Rotations[i].Quaternion()));
+
+				TotalPositionError += PositionError;
+				TotalRotationError += RotationError;
+				MaxPositionError = FMath::Max(MaxPositionError, PositionError);
+				MaxRotationError = FMath::Max(MaxRotationError, RotationError);
+				++NumReceived;
+			}
+
+			const int32 ErrorCount = FMath::Max(NumReceived, 1);
+			UE_LOG(LogVRDataTypes, Display, TEXT("  %-34s %6.2f bits/pose | pos err avg %.3fmm max %.3fmm | rot err avg %.3fdeg max %.3fdeg | lost %d, dropped deltas %d"),
+				Mode.Name,
+				(double)TotalBits / NumSamples,
+				TotalPositionError / ErrorCount,
+				MaxPositionError,
+				TotalRotationError / ErrorCount,
+				MaxRotationError,
+				NumLost,
+				NumDropped);
+		}
+	}
+
+	static FAutoConsoleCommand CmdBenchmarkPosRepQuantization(
+		TEXT("vrexp.BenchmarkPosRepQuantization"),
+		TEXT("Logs bits per pose and position (mm) / rotation (deg) error of each FBPVRComponentPosRep quantization mode over a synthetic hand motion stream.\n")
+		TEXT("Usage: vrexp.BenchmarkPosRepQuantization [NumSamples=900] [PacketLossPercent=0]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkPosRepQuantization));
+}
\ No newline at end of file
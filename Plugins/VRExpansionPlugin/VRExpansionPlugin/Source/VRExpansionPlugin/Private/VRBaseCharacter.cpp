@@ -7,6 +7,9 @@
 
 DEFINE_LOG_CATEGORY(LogBaseVRCharacter);
 
+DECLARE_CYCLE_STAT(TEXT("VRChar Seat Evaluation"), STAT_VRSeatEvaluation, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar Seat Evaluations Skipped"), STAT_VRSeatEvaluationsSkipped, STATGROUP_Character);
+
 FName AVRBaseCharacter::LeftMotionControllerComponentName(TEXT("Left Grip Motion Controller"));
 FName AVRBaseCharacter::RightMotionControllerComponentName(TEXT("Right Grip Motion Controller"));
 FName AVRBaseCharacter::ReplicatedCameraComponentName(TEXT("VR Replicated Camera"));
@@ -96,6 +99,189 @@ AVRBaseCharacter::AVRBaseCharacter(const FObjectInitializer& ObjectInitializer)
 	ReplicatedMovement.RotationQuantizationLevel = ERotatorQuantization::ShortComponents;
 
 	VRReplicateCapsuleHeight = false;
+
+	bUseCombinedPoseReplication = false;
+	PoseNetUpdateRate = 100.0f; // 100 htz is default
+	PoseNetUpdateCount = 0.0f;
+
+	SeatEvaluationThreshold = 0.1f;
+}
+
+void AVRBaseCharacter::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	if (bUseCombinedPoseReplication)
+	{
+		if (VRReplicatedCamera)
+			VRReplicatedCamera->bReplicatesWithOwnerPose = true;
+
+		// Sample the controllers after they have polled for the frame
+		if (LeftMotionController)
+		{
+			LeftMotionController->bReplicatesWithOwnerPose = true;
+			AddTickPrerequisiteComponent(LeftMotionController);
+		}
+
+		if (RightMotionController)
+		{
+			RightMotionController->bReplicatesWithOwnerPose = true;
+			AddTickPrerequisiteComponent(RightMotionController);
+		}
+	}
+}
+
+void AVRBaseCharacter::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bUseCombinedPoseReplication && IsLocallyControlled())
+	{
+		TickPoseReplication(DeltaTime);
+	}
+}
+
+void AVRBaseCharacter::TickPoseReplication(float DeltaTime)
+{
+	uint8 ChangedDevices = 0;
+
+	if (VRReplicatedCamera && VRReplicatedCamera->GetIsReplicated())
+	{
+		if (!VRReplicatedCamera->RelativeLocation.Equals(ReplicatedPose.HMD.Position) || !VRReplicatedCamera->RelativeRotation.Equals(ReplicatedPose.HMD.Rotation))
+			ChangedDevices |= FBPVRCharacterPoseRep::PoseRep_HMD;
+	}
+
+	if (LeftMotionController && LeftMotionController->GetIsReplicated() && (LeftMotionController->GripControllerIsTracked() || LeftMotionController->bReplicateWithoutTracking))
+	{
+		if (!LeftMotionController->RelativeLocation.Equals(ReplicatedPose.LeftController.Position) || !LeftMotionController->RelativeRotation.Equals(ReplicatedPose.LeftController.Rotation))
+			ChangedDevices |= FBPVRCharacterPoseRep::PoseRep_LeftController;
+	}
+
+	if (RightMotionController && RightMotionController->GetIsReplicated() && (RightMotionController->GripControllerIsTracked() || RightMotionController->bReplicateWithoutTracking))
+	{
+		if (!RightMotionController->RelativeLocation.Equals(ReplicatedPose.RightController.Position) || !RightMotionController->RelativeRotation.Equals(ReplicatedPose.RightController.Rotation))
+			ChangedDevices |= FBPVRCharacterPoseRep::PoseRep_RightController;
+	}
+
+	// Don't rep if no changes
+	if (!ChangedDevices)
+		return;
+
+	PoseNetUpdateCount += DeltaTime;
+	if (PoseNetUpdateCount < (1.0f / PoseNetUpdateRate))
+		return;
+
+	PoseNetUpdateCount = 0.0f;
+
+	ReplicatedPose.TimeStamp = GetWorld()->GetTimeSeconds();
+	ReplicatedPose.ContainedDevices = ChangedDevices;
+
+	if (ChangedDevices & FBPVRCharacterPoseRep::PoseRep_HMD)
+	{
+		ReplicatedPose.HMD.Position = VRReplicatedCamera->RelativeLocation;
+		ReplicatedPose.HMD.Rotation = VRReplicatedCamera->RelativeRotation;
+	}
+
+	if (ChangedDevices & FBPVRCharacterPoseRep::PoseRep_LeftController)
+	{
+		ReplicatedPose.LeftController.Position = LeftMotionController->RelativeLocation;
+		ReplicatedPose.LeftController.Rotation = LeftMotionController->RelativeRotation;
+	}
+
+	if (ChangedDevices & FBPVRCharacterPoseRep::PoseRep_RightController)
+	{
+		ReplicatedPose.RightController.Position = RightMotionController->RelativeLocation;
+		ReplicatedPose.RightController.Rotation = RightMotionController->RelativeRotation;
+	}
+
+	if (GetNetMode() == NM_Client)
+	{
+		// Devices use the shared pose quantization, each one keeps its own keyframes on its component
+		if (ChangedDevices & FBPVRCharacterPoseRep::PoseRep_HMD)
+			EncodePoseDevice(ReplicatedPose.HMD, VRReplicatedCamera->NetDeltaState);
+
+		if (ChangedDevices & FBPVRCharacterPoseRep::PoseRep_LeftController)
+			EncodePoseDevice(ReplicatedPose.LeftController, LeftMotionController->NetDeltaState);
+
+		if (ChangedDevices & FBPVRCharacterPoseRep::PoseRep_RightController)
+			EncodePoseDevice(ReplicatedPose.RightController, RightMotionController->NetDeltaState);
+
+		Server_SendPose(ReplicatedPose);
+	}
+	else
+	{
+		// We are the server and own this pawn, replicated copy always carries all three devices
+		ReplicatedPose.ContainedDevices = FBPVRCharacterPoseRep::PoseRep_All;
+	}
+}
+
+void AVRBaseCharacter::EncodePoseDevice(FBPVRComponentPosRep & Device, FBPVRPosRepDeltaState & DeltaState)
+{
+	Device.QuantizationLevel = ReplicatedPose.QuantizationLevel;
+	Device.RotationQuantizationLevel = ReplicatedPose.RotationQuantizationLevel;
+	DeltaState.Encode(Device);
+}
+
+void AVRBaseCharacter::OnRep_ReplicatedPose()
+{
+	if (VRReplicatedCamera && ReplicatedPose.HasDevice(FBPVRCharacterPoseRep::PoseRep_HMD))
+	{
+		VRReplicatedCamera->ReplicatedCameraTransform = ReplicatedPose.HMD;
+		VRReplicatedCamera->RemoteSampleTimeStamp = ReplicatedPose.TimeStamp;
+		VRReplicatedCamera->OnRep_ReplicatedCameraTransform();
+	}
+
+	if (LeftMotionController && ReplicatedPose.HasDevice(FBPVRCharacterPoseRep::PoseRep_LeftController))
+	{
+		LeftMotionController->ReplicatedControllerTransform = ReplicatedPose.LeftController;
+		LeftMotionController->RemoteSampleTimeStamp = ReplicatedPose.TimeStamp;
+		LeftMotionController->OnRep_ReplicatedControllerTransform();
+	}
+
+	if (RightMotionController && ReplicatedPose.HasDevice(FBPVRCharacterPoseRep::PoseRep_RightController))
+	{
+		RightMotionController->ReplicatedControllerTransform = ReplicatedPose.RightController;
+		RightMotionController->RemoteSampleTimeStamp = ReplicatedPose.TimeStamp;
+		RightMotionController->OnRep_ReplicatedControllerTransform();
+	}
+}
+
+void AVRBaseCharacter::Server_SendPose_Implementation(FBPVRCharacterPoseRep NewPose)
+{
+	// Pass each sampled device through to its component, same as the individual RPCs
+	// Copy back what the component resolved so that delta encoded devices re-replicate as absolute keyframes
+	if (VRReplicatedCamera && NewPose.HasDevice(FBPVRCharacterPoseRep::PoseRep_HMD))
+	{
+		VRReplicatedCamera->RemoteSampleTimeStamp = NewPose.TimeStamp;
+		VRReplicatedCamera->Server_SendCameraTransform_Implementation(NewPose.HMD);
+		ReplicatedPose.HMD = VRReplicatedCamera->ReplicatedCameraTransform;
+	}
+
+	if (LeftMotionController && NewPose.HasDevice(FBPVRCharacterPoseRep::PoseRep_LeftController))
+	{
+		LeftMotionController->RemoteSampleTimeStamp = NewPose.TimeStamp;
+		LeftMotionController->Server_SendControllerTransform_Implementation(NewPose.LeftController);
+		ReplicatedPose.LeftController = LeftMotionController->ReplicatedControllerTransform;
+	}
+
+	if (RightMotionController && NewPose.HasDevice(FBPVRCharacterPoseRep::PoseRep_RightController))
+	{
+		RightMotionController->RemoteSampleTimeStamp = NewPose.TimeStamp;
+		RightMotionController->Server_SendControllerTransform_Implementation(NewPose.RightController);
+		ReplicatedPose.RightController = RightMotionController->ReplicatedControllerTransform;
+	}
+
+	// Remote clients always get the full pose so that they can't miss a device that wasn't in the latest sample
+	ReplicatedPose.TimeStamp = NewPose.TimeStamp;
+	ReplicatedPose.QuantizationLevel = NewPose.QuantizationLevel;
+	ReplicatedPose.RotationQuantizationLevel = NewPose.RotationQuantizationLevel;
+	ReplicatedPose.ContainedDevices = FBPVRCharacterPoseRep::PoseRep_All;
+}
+
+bool AVRBaseCharacter::Server_SendPose_Validate(FBPVRCharacterPoseRep NewPose)
+{
+	return true;
+	// Optionally check to make sure that player is inside of their bounds and deny it if they aren't?
 }
 
 void AVRBaseCharacter::OnRep_PlayerState()
@@ -110,13 +296,22 @@ void AVRBaseCharacter::GetLifetimeReplicatedProps(TArray< class FLifetimePropert
 	DOREPLIFETIME_CONDITION(AVRBaseCharacter, SeatInformation, COND_None);
 	DOREPLIFETIME_CONDITION(AVRBaseCharacter, VRReplicateCapsuleHeight, COND_None);
 	DOREPLIFETIME_CONDITION(AVRBaseCharacter, ReplicatedCapsuleHeight, COND_SimulatedOnly);
+	DOREPLIFETIME_CONDITION(AVRBaseCharacter, ReplicatedPose, COND_SkipOwner);
 }
 
 void AVRBaseCharacter::PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker)
 {
 	Super::PreReplication(ChangedPropertyTracker);
 
+	// Hide server only nav walking from simulated proxies
+	if (UVRBaseCharacterMovementComponent * VRMove = Cast<UVRBaseCharacterMovementComponent>(GetCharacterMovement()))
+	{
+		if (VRMove->bIsServerNavWalking)
+			ReplicatedMovementMode = VRMove->PackNetworkMovementModeVR();
+	}
+
 	DOREPLIFETIME_ACTIVE_OVERRIDE(AVRBaseCharacter, ReplicatedCapsuleHeight, VRReplicateCapsuleHeight);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(AVRBaseCharacter, ReplicatedPose, bUseCombinedPoseReplication);
 }
 
 USkeletalMeshComponent* AVRBaseCharacter::GetIKMesh_Implementation() const
@@ -229,14 +424,26 @@ void AVRBaseCharacter::NotifyOfTeleport_Implementation()
 
 void AVRBaseCharacter::TickSeatInformation(float DeltaTime)
 {
-	float LastThresholdScaler = SeatInformation.CurrentThresholdScaler;
-	bool bLastOverThreshold = SeatInformation.bIsOverThreshold;
+	SCOPE_CYCLE_COUNTER(STAT_VRSeatEvaluation);
 
 	FVector NewLoc = VRReplicatedCamera->RelativeLocation;
 
 	if (!SeatInformation.bZeroToHead)
 		NewLoc.Z = 0.0f;
 
+	// Correcting the limits moves the actor, not the HMD, so if the HMD hasn't moved in tracking space then nothing below would change
+	if (!SeatInformation.bNeedsEvaluation && FVector::DistSquared(NewLoc, SeatInformation.LastEvaluatedLocation) <= FMath::Square(SeatEvaluationThreshold))
+	{
+		INC_DWORD_STAT(STAT_VRSeatEvaluationsSkipped);
+		return;
+	}
+
+	SeatInformation.bNeedsEvaluation = false;
+	SeatInformation.LastEvaluatedLocation = NewLoc;
+
+	float LastThresholdScaler = SeatInformation.CurrentThresholdScaler;
+	bool bLastOverThreshold = SeatInformation.bIsOverThreshold;
+
 	float AbsDistance = FMath::Abs(FVector::Dist(SeatInformation.StoredLocation, NewLoc));
 
 	// If over the allowed distance
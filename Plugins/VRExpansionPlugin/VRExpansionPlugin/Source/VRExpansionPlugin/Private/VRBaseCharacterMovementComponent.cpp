@@ -11,6 +11,18 @@
 #include "VRRootComponent.h"
 #include "VRPlayerController.h"
 #include "GameFramework/PhysicsVolume.h"
+#include "Misc/VRClimbableSurfaceIndex.h"
+#include "Misc/VRMovementProfiler.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar FloorCache Hits"), STAT_VRFloorCacheHits, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar FloorCache Misses"), STAT_VRFloorCacheMisses, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar Client Corrections"), STAT_VRClientCorrections, STATGROUP_Character);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("VRChar Moves Replayed Last Correction"), STAT_VRMovesReplayedLastCorrection, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar Replay Moves Combined"), STAT_VRReplayMovesCombined, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar Replay Snaps"), STAT_VRReplaySnaps, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar Fixed Server Steps"), STAT_VRFixedServerSteps, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar Climb StepUps Skipped By Index"), STAT_VRClimbIndexSkips, STATGROUP_Character);
+DECLARE_CYCLE_STAT(TEXT("VRChar SmoothCorrection"), STAT_VRSmoothCorrection, STATGROUP_Character);
 
 UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -32,6 +44,7 @@ UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObje
 	CustomVRInputVector = FVector::ZeroVector;
 	bApplyAdditionalVRInputVectorAsNegative = true;
 	VRClimbingStepHeight = 96.0f;
+	bUseClimbableSurfaceIndex = false;
 	VRClimbingEdgeRejectDistance = 5.0f;
 	VRClimbingStepUpMultiplier = 1.0f;
 	bClampClimbingStepUp = false;
@@ -57,6 +70,151 @@ UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObje
 	bIsInPushBack = false;
 
 	bRunControlRotationInMovementComponent = true;
+
+	bUseFloorCache = false;
+	FloorCacheTolerance = 0.25f;
+
+	ClientReplayBudget = 24;
+	ClientReplaySnapThreshold = 90;
+	AdaptiveMoveCombineThreshold = 0;
+
+	bUseFixedServerTimestep = false;
+	FixedServerTimeStep = 1.0f / 90.0f;
+	ServerMoveBudgetMs = 0.0f;
+	MaxDeferredServerMoves = 16;
+	bInFixedServerStep = false;
+	bIsServerNavWalking = false;
+	ServerMoveBudgetFrame = 0;
+	ServerMoveFrameSeconds = 0.0;
+}
+
+uint8 UVRBaseCharacterMovementComponent::PackNetworkMovementModeVR() const
+{
+	if (bIsServerNavWalking && MovementMode == MOVE_NavWalking)
+	{
+		// Ground mode stays walking too, so the client lands back into walking
+		return (uint8(MOVE_Walking) | (uint8(MOVE_Walking) << 4));
+	}
+
+	return PackNetworkMovementMode();
+}
+
+bool UVRBaseCharacterMovementComponent::IsOverServerMoveBudget()
+{
+	if (ServerMoveBudgetMs <= 0.0f)
+		return false;
+
+	if (ServerMoveBudgetFrame != GFrameCounter)
+	{
+		ServerMoveBudgetFrame = GFrameCounter;
+		ServerMoveFrameSeconds = 0.0;
+	}
+
+	return (ServerMoveFrameSeconds * 1000.0) >= ServerMoveBudgetMs;
+}
+
+void UVRBaseCharacterMovementComponent::AddServerMoveCost(double Seconds)
+{
+	if (ServerMoveBudgetFrame != GFrameCounter)
+	{
+		ServerMoveBudgetFrame = GFrameCounter;
+		ServerMoveFrameSeconds = 0.0;
+	}
+
+	ServerMoveFrameSeconds += Seconds;
+}
+
+void UVRBaseCharacterMovementComponent::MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel)
+{
+	// Only for client moves on the server, clients replaying their own moves use the normal steps
+	if (!bUseFixedServerTimestep || FixedServerTimeStep <= 0.0f || !CharacterOwner || CharacterOwner->Role != ROLE_Authority)
+	{
+		Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAccel);
+		return;
+	}
+
+	// Same 0.1ms grid that batched moves send their timestamps on, so either RPC path steps a move the same way
+	const float QuantizedDelta = FMath::Max(FMath::RoundToFloat(DeltaTime * 10000.0f) / 10000.0f, 0.0001f);
+	const int32 NumSteps = FMath::CeilToInt(QuantizedDelta / FixedServerTimeStep);
+	INC_DWORD_STAT_BY(STAT_VRFixedServerSteps, NumSteps);
+
+	// Enough iterations for every fixed step, otherwise the last iteration would eat the rest of the time in one go
+	// Extra headroom for steps that end early (landing, starting to fall, stepping up) and burn an iteration without a full step
+	TGuardValue<int32> IterationGuard(MaxSimulationIterations, NumSteps + MaxSimulationIterations);
+	TGuardValue<bool> FixedStepGuard(bInFixedServerStep, true);
+	Super::MoveAutonomous(ClientTimeStamp, QuantizedDelta, CompressedFlags, NewAccel);
+}
+
+float UVRBaseCharacterMovementComponent::GetSimulationTimeStep(float RemainingTime, int32 Iterations) const
+{
+	if (bInFixedServerStep)
+	{
+		// Same as the base, the last allowed iteration takes all of the remaining time so the server never simulates less than the client
+		if (Iterations >= MaxSimulationIterations)
+			return RemainingTime;
+
+		return FMath::Min(FixedServerTimeStep, RemainingTime);
+	}
+
+	return Super::GetSimulationTimeStep(RemainingTime, Iterations);
+}
+
+void UVRBaseCharacterMovementComponent::ApplyClientReplayBudget()
+{
+	FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
+
+	// Correction was thrown out
+	if (!ClientData || !ClientData->bUpdatePosition || !CharacterOwner)
+		return;
+
+	INC_DWORD_STAT(STAT_VRClientCorrections);
+
+	TArray<FSavedMovePtr> & SavedMoves = ClientData->SavedMoves;
+	const bool bHasPendingMove = ClientData->PendingMove.IsValid() && SavedMoves.Num() > 0 && SavedMoves.Last() == ClientData->PendingMove;
+
+	// The pending move hasn't been sent yet, it stays in the list no matter what
+	const int32 LastCombinableIndex = SavedMoves.Num() - (bHasPendingMove ? 2 : 1);
+
+	if (ClientReplaySnapThreshold > 0 && SavedMoves.Num() > ClientReplaySnapThreshold)
+	{
+		// Too far behind to catch up, take the servers position and resume predicting from there
+		for (int32 i = 0; i <= LastCombinableIndex; ++i)
+		{
+			ClientData->FreeMove(SavedMoves[i]);
+		}
+
+		SavedMoves.RemoveAt(0, LastCombinableIndex + 1, false);
+		INC_DWORD_STAT(STAT_VRReplaySnaps);
+	}
+	else if (ClientReplayBudget > 0 && SavedMoves.Num() > ClientReplayBudget)
+	{
+		// Fold the oldest moves together first, the newest ones matter most for where we end up
+		const float MaxDelta = ClientData->MaxMoveDeltaTime * CharacterOwner->GetActorTimeDilation();
+		int32 LastIndex = LastCombinableIndex;
+
+		for (int32 i = 0; i < LastIndex && SavedMoves.Num() > ClientReplayBudget;)
+		{
+			FSavedMove_VRBaseCharacter * OlderMove = (FSavedMove_VRBaseCharacter *)SavedMoves[i].Get();
+			FSavedMove_VRBaseCharacter * NewerMove = (FSavedMove_VRBaseCharacter *)SavedMoves[i + 1].Get();
+
+			if (OlderMove && NewerMove && OlderMove->CanCombineWith(SavedMoves[i + 1], CharacterOwner, MaxDelta))
+			{
+				NewerMove->CombineForReplay(OlderMove);
+				ClientData->FreeMove(SavedMoves[i]);
+				SavedMoves.RemoveAt(i, 1, false);
+				--LastIndex;
+				INC_DWORD_STAT(STAT_VRReplayMovesCombined);
+
+				// Stay on this index so the combined move can take in the next one too
+			}
+			else
+			{
+				++i;
+			}
+		}
+	}
+
+	SET_DWORD_STAT(STAT_VRMovesReplayedLastCorrection, SavedMoves.Num());
 }
 
 void UVRBaseCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
@@ -248,7 +406,73 @@ bool UVRBaseCharacterMovementComponent::FloorSweepTest(
 	return bBlockingHit;
 }*/
 
+void UVRBaseCharacterMovementComponent::OnTeleported()
+{
+	InvalidateFloorCache();
+	Super::OnTeleported();
+}
+
+bool UVRBaseCharacterMovementComponent::CanUseFloorCache(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, float SweepRadius) const
+{
+	if (!FloorCache.bValid || bJustTeleported)
+		return false;
+
+	// Different movement mode or capsule size changes the trace lengths
+	if (LineDistance != FloorCache.LineDistance || SweepDistance != FloorCache.SweepDistance || SweepRadius != FloorCache.SweepRadius)
+		return false;
+
+	if (FVector::DistSquared(CapsuleLocation, FloorCache.CapsuleLocation) > FMath::Square(FloorCacheTolerance))
+		return false;
+
+	UPrimitiveComponent * FloorComp = FloorCache.FloorComponent.Get();
+	if (!FloorComp || MovementBaseUtility::IsDynamicBase(FloorComp) || CharacterOwner->GetMovementBase() != FloorCache.MovementBase.Get())
+		return false;
+
+	// Catches static floors being moved in editor / by code anyway
+	return FloorComp->GetComponentLocation().Equals(FloorCache.FloorLocation, 0.0f);
+}
+
 void UVRBaseCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const
+{
+	if (!bUseFloorCache)
+	{
+		ComputeFloorDist_Uncached(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, DownwardSweepResult);
+		return;
+	}
+
+	// A supplied downward sweep is fresh and free, always prefer it
+	if (DownwardSweepResult == NULL && CanUseFloorCache(CapsuleLocation, LineDistance, SweepDistance, SweepRadius))
+	{
+		INC_DWORD_STAT(STAT_VRFloorCacheHits);
+
+		// Same floor, just shift the distances by how far we moved vertically
+		const float ZDelta = CapsuleLocation.Z - FloorCache.CapsuleLocation.Z;
+		OutFloorResult = FloorCache.Result;
+		OutFloorResult.FloorDist += ZDelta;
+		OutFloorResult.LineDist += ZDelta;
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_VRFloorCacheMisses);
+	ComputeFloorDist_Uncached(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, DownwardSweepResult);
+
+	UPrimitiveComponent * FloorComp = OutFloorResult.HitResult.Component.Get();
+	FloorCache.bValid = OutFloorResult.IsWalkableFloor() && FloorComp && !MovementBaseUtility::IsDynamicBase(FloorComp);
+
+	if (FloorCache.bValid)
+	{
+		FloorCache.Result = OutFloorResult;
+		FloorCache.CapsuleLocation = CapsuleLocation;
+		FloorCache.FloorLocation = FloorComp->GetComponentLocation();
+		FloorCache.LineDistance = LineDistance;
+		FloorCache.SweepDistance = SweepDistance;
+		FloorCache.SweepRadius = SweepRadius;
+		FloorCache.FloorComponent = FloorComp;
+		FloorCache.MovementBase = CharacterOwner->GetMovementBase();
+	}
+}
+
+void UVRBaseCharacterMovementComponent::ComputeFloorDist_Uncached(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const
 {
 	//UE_LOG(LogCharacterMovement, VeryVerbose, TEXT("[Role:%d] ComputeFloorDist: %s at location %s"), (int32)CharacterOwner->Role, *GetNameSafe(CharacterOwner), *CapsuleLocation.ToString());
 	OutFloorResult.Clear();
@@ -626,6 +850,29 @@ bool UVRBaseCharacterMovementComponent::VRClimbStepUp(const FVector& GravDir, co
 	return StepUp(GravDir, Delta, InHit, OutStepDownResult);
 }
 
+bool UVRBaseCharacterMovementComponent::CanClimbStepUpFromIndex(const FHitResult & Hit) const
+{
+	if (!bUseClimbableSurfaceIndex || !UpdatedPrimitive || !CharacterOwner)
+		return true;
+
+	const AVRClimbableSurfaceIndex * ClimbIndex = AVRClimbableSurfaceIndex::FindIndexForActor(GetWorld(), Hit.GetActor());
+	if (!ClimbIndex)
+		return true;
+
+	float PawnRadius, PawnHalfHeight;
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(PawnRadius, PawnHalfHeight);
+
+	// Bounds instead of the component location so that the VR roots offset is included
+	const float FloorZ = UpdatedPrimitive->Bounds.Origin.Z - PawnHalfHeight;
+
+	// Same height window that the step up itself accepts, the sweeps still confirm the final position
+	if (ClimbIndex->HasLedgeNear(Hit.ImpactPoint, FloorZ, FloorZ + VRClimbingStepHeight, PawnRadius * 2.0f))
+		return true;
+
+	INC_DWORD_STAT(STAT_VRClimbIndexSkips);
+	return false;
+}
+
 void UVRBaseCharacterMovementComponent::PhysCustom_Climbing(float deltaTime, int32 Iterations)
 {
 	if (deltaTime < MIN_TICK_TIME)
@@ -667,7 +914,7 @@ void UVRBaseCharacterMovementComponent::PhysCustom_Climbing(float deltaTime, int
 			const float UpDown = GravDir | VelDir;
 
 			//bool bSteppedUp = false;
-			if ((FMath::Abs(Hit.ImpactNormal.Z) < 0.2f) && (UpDown < 0.5f) && (UpDown > -0.2f) && CanStepUp(Hit))
+			if ((FMath::Abs(Hit.ImpactNormal.Z) < 0.2f) && (UpDown < 0.5f) && (UpDown > -0.2f) && CanStepUp(Hit) && CanClimbStepUpFromIndex(Hit))
 			{
 				// Scope our movement updates, and do not apply them until all intermediate moves are completed.
 				FVRCharacterScopedMovementUpdate ScopedStepUpMovement(UpdatedComponent, EScopedUpdate::DeferredUpdates);
@@ -1133,6 +1380,23 @@ void FSavedMove_VRBaseCharacter::CombineWith(const FSavedMove_Character* OldMove
 	InCharacter->JumpKeyHoldTime = OldMove->JumpKeyHoldTime;
 }
 
+void FSavedMove_VRBaseCharacter::CombineForReplay(const FSavedMove_VRBaseCharacter* OlderMove)
+{
+	// End state and timestamp are already ours, the start state comes from the older move
+	DeltaTime += OlderMove->DeltaTime;
+	LFDiff.X += OlderMove->LFDiff.X;
+	LFDiff.Y += OlderMove->LFDiff.Y;
+
+	StartLocation = OlderMove->StartLocation;
+	StartRelativeLocation = OlderMove->StartRelativeLocation;
+	StartVelocity = OlderMove->StartVelocity;
+	StartFloor = OlderMove->StartFloor;
+	StartRotation = OlderMove->StartRotation;
+	StartControlRotation = OlderMove->StartControlRotation;
+	StartBase = OlderMove->StartBase;
+	StartBoneName = OlderMove->StartBoneName;
+}
+
 void FSavedMove_VRBaseCharacter::PostUpdate(ACharacter* C, EPostUpdateMode PostUpdateMode)
 {
 	FSavedMove_Character::PostUpdate(C, PostUpdateMode);
@@ -1214,6 +1478,8 @@ void FSavedMove_VRBaseCharacter::PrepMoveFor(ACharacter* Character)
 void UVRBaseCharacterMovementComponent::SmoothCorrection(const FVector& OldLocation, const FQuat& OldRotation, const FVector& NewLocation, const FQuat& NewRotation)
 {
 	//SCOPE_CYCLE_COUNTER(STAT_CharacterMovementSmoothCorrection);
+	SCOPE_CYCLE_COUNTER(STAT_VRSmoothCorrection);
+	VR_SCOPE_MOVEMENT_PHASE(SmoothCorrection);
 	if (!HasValidData())
 	{
 		return;
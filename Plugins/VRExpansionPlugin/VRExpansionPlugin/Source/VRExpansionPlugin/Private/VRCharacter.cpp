@@ -387,6 +387,16 @@ void AVRCharacter::ServerMoveVR_Implementation(
 		ClientMovementMode);
 }
 
+bool AVRCharacter::ServerMoveVRBatch_Validate(const FVRServerMoveBatch& MoveBatch)
+{
+	return ((UVRCharacterMovementComponent*)GetCharacterMovement())->ServerMoveVRBatch_Validate(MoveBatch);
+}
+
+void AVRCharacter::ServerMoveVRBatch_Implementation(const FVRServerMoveBatch& MoveBatch)
+{
+	((UVRCharacterMovementComponent*)GetCharacterMovement())->ServerMoveVRBatch_Implementation(MoveBatch);
+}
+
 
 // ClientAdjustPosition
 void AVRCharacter::ClientAdjustPositionVR_Implementation(float TimeStamp, FVector NewLoc, uint16 NewYaw, FVector NewVel, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode)
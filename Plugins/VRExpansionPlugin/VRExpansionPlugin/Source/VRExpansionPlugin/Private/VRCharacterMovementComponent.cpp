@@ -26,6 +26,10 @@
 
 #include "Engine/DemoNetDriver.h"
 #include "Engine/NetworkObjectList.h"
+#include "Engine/Engine.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerState.h"
+#include "Misc/VRMovementProfiler.h"
 
 //#include "PerfCountersHelpers.h"
 
@@ -44,8 +48,21 @@ DECLARE_CYCLE_STAT(TEXT("Char PhysFalling"), STAT_CharPhysFalling, STATGROUP_Cha
 DECLARE_CYCLE_STAT(TEXT("Char PhysNavWalking"), STAT_CharPhysNavWalking, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char NavProjectPoint"), STAT_CharNavProjectPoint, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char NavProjectLocation"), STAT_CharNavProjectLocation, STATGROUP_Character);
+DECLARE_CYCLE_STAT(TEXT("VRChar Repulsion Force"), STAT_VRRepulsionForce, STATGROUP_Character);
+DECLARE_CYCLE_STAT(TEXT("VRChar MoveAlongFloor"), STAT_VRMoveAlongFloor, STATGROUP_Character);
+DECLARE_CYCLE_STAT(TEXT("VRChar ServerCheckClientError"), STAT_VRServerCheckClientError, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar Corrections Sent"), STAT_VRCorrectionsSent, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar Corrections Deduplicated"), STAT_VRCorrectionsDeduplicated, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar Repulsion Bodies Analytic"), STAT_VRRepulsionAnalytic, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRChar Repulsion Bodies Exact"), STAT_VRRepulsionExact, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char AdjustFloorHeight"), STAT_CharAdjustFloorHeight, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char ProcessLanded"), STAT_CharProcessLanded, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Batched Moves Processed"), STAT_VRBatchedMovesProcessed, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Batched Moves Resent"), STAT_VRBatchedMovesResent, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Server Moves Deferred"), STAT_VRServerMovesDeferred, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Proxies Full"), STAT_VRProxiesFull, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Proxies Reduced"), STAT_VRProxiesReduced, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Proxies Interpolated"), STAT_VRProxiesInterpolated, STATGROUP_Character);
 
 // MAGIC NUMBERS
 const float MAX_STEP_SIDE_Z = 0.08f;	// maximum z value for the normal on the vertical side of steps
@@ -73,6 +90,48 @@ namespace CharacterMovementComponentStatics
 		TEXT("Rotation is replicated at 2 decimal precision, so values less than 0.01 won't matter."),
 		ECVF_Default);
 
+	static int32 bEnableProxySignificance = 1;
+	FAutoConsoleVariableRef CVarEnableProxySignificance(
+		TEXT("vre.EnableProxySignificance"),
+		bEnableProxySignificance,
+		TEXT("Whether remote VR characters are simulated less when far away or small on screen.\n")
+		TEXT("0: Always fully simulate, 1: Use each movement components significance settings (default)"),
+		ECVF_Default);
+
+	// The local view is shared by every proxy, only look it up once a frame
+	struct FProxyViewerCache
+	{
+		TWeakObjectPtr<UWorld> World;
+		uint64 Frame;
+		bool bValid;
+		FVector Location;
+		float TanHalfFOV;
+
+		FProxyViewerCache() : Frame(0), bValid(false), Location(FVector::ZeroVector), TanHalfFOV(1.0f) {}
+	};
+	static FProxyViewerCache ProxyViewer;
+
+	static bool GetProxyViewer(UWorld * World, FVector & OutLocation, float & OutTanHalfFOV)
+	{
+		if (ProxyViewer.Frame != GFrameCounter || ProxyViewer.World.Get() != World)
+		{
+			ProxyViewer.Frame = GFrameCounter;
+			ProxyViewer.World = World;
+			ProxyViewer.bValid = false;
+
+			APlayerController * PC = GEngine ? GEngine->GetFirstLocalPlayerController(World) : nullptr;
+			if (PC && PC->PlayerCameraManager)
+			{
+				ProxyViewer.Location = PC->PlayerCameraManager->GetCameraLocation();
+				ProxyViewer.TanHalfFOV = FMath::Max(FMath::Tan(FMath::DegreesToRadians(PC->PlayerCameraManager->GetFOVAngle() * 0.5f)), KINDA_SMALL_NUMBER);
+				ProxyViewer.bValid = true;
+			}
+		}
+
+		OutLocation = ProxyViewer.Location;
+		OutTanHalfFOV = ProxyViewer.TanHalfFOV;
+		return ProxyViewer.bValid;
+	}
 }
 
 void UVRCharacterMovementComponent::Crouch(bool bClientSimulation)
@@ -447,11 +506,70 @@ bool UVRCharacterMovementComponent::ServerMoveVRDualExLight_Validate(float TimeS
 	return true;
 }
 
+bool UVRCharacterMovementComponent::ServerMoveVRBatch_Validate(const FVRServerMoveBatch& MoveBatch)
+{
+	return true;
+}
+
 bool UVRCharacterMovementComponent::ServerMoveVRDualHybridRootMotion_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags,  uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return true;
 }
 
+void UVRCharacterMovementComponent::ServerMoveVRBatch_Implementation(const FVRServerMoveBatch& MoveBatch)
+{
+	if (!MoveBatch.Moves.Num() || !HasValidData() || !IsComponentTickEnabled())
+	{
+		return;
+	}
+
+	FNetworkPredictionData_Server_Character* ServerData = GetPredictionData_Server_Character();
+	check(ServerData);
+
+	// Older timestamps are rebuilt from deltas, so they can be off by a tick from what we already processed
+	const float TimeStampTolerance = 1.0f / FVRServerMoveBatch::TimeStampTicksPerSecond;
+
+	// Scope the whole batch, they nest with Outer references so the capsule and children only update once for all of the moves
+	FVRCharacterScopedMovementUpdate ScopedMovementUpdate(UpdatedComponent, bEnableScopedMovementUpdates ? EScopedUpdate::DeferredUpdates : EScopedUpdate::ImmediateUpdates);
+
+	const int32 NewestIndex = MoveBatch.Moves.Num() - 1;
+	for (int32 i = 0; i < NewestIndex; ++i)
+	{
+		const FVRBatchedMove & Move = MoveBatch.Moves[i];
+
+		// Resent for packet loss and we already have it, skip it here instead of letting it fail the timestamp check
+		// CurrentClientTimeStamp doesn't move while moves are deferred, so check the queue for it as well
+		bool bTimeStampResetDetected = false;
+		if (FMath::Abs(Move.TimeStamp - ServerData->CurrentClientTimeStamp) <= TimeStampTolerance ||
+			IsServerMoveDeferred(Move.TimeStamp, TimeStampTolerance) ||
+			(!IsClientTimeStampValid(Move.TimeStamp, *ServerData, bTimeStampResetDetected) && !bTimeStampResetDetected))
+		{
+			INC_DWORD_STAT(STAT_VRBatchedMovesResent);
+			continue;
+		}
+
+		// Keep new moves base and bone, but use the View of the old move
+		FVRConditionalMoveRep2 MoveRepsOld;
+		MoveRepsOld.ClientBaseBoneName = MoveBatch.MoveReps.ClientBaseBoneName;
+		MoveRepsOld.ClientMovementBase = MoveBatch.MoveReps.ClientMovementBase;
+		MoveRepsOld.UnpackAndSetINTRotations(Move.View);
+
+		if (Move.bIgnoreRootMotion)
+		{
+			CharacterOwner->bServerMoveIgnoreRootMotion = CharacterOwner->IsPlayingNetworkedRootMotionMontage();
+		}
+
+		ServerMoveVR_Implementation(Move.TimeStamp, Move.Acceleration, FVector(1.f, 2.f, 3.f), Move.CapsuleLoc, Move.ConditionalReps, Move.LFDiff, Move.CapsuleYaw, Move.MoveFlags, MoveRepsOld, MoveBatch.ClientMovementMode);
+		CharacterOwner->bServerMoveIgnoreRootMotion = false;
+		INC_DWORD_STAT(STAT_VRBatchedMovesProcessed);
+	}
+
+	// Only the newest move is checked against the clients location
+	const FVRBatchedMove & NewestMove = MoveBatch.Moves[NewestIndex];
+	ServerMoveVR_Implementation(NewestMove.TimeStamp, NewestMove.Acceleration, MoveBatch.ClientLoc, NewestMove.CapsuleLoc, NewestMove.ConditionalReps, NewestMove.LFDiff, NewestMove.CapsuleYaw, NewestMove.MoveFlags, MoveBatch.MoveReps, MoveBatch.ClientMovementMode);
+	INC_DWORD_STAT(STAT_VRBatchedMovesProcessed);
+}
+
 void UVRCharacterMovementComponent::ServerMoveVRDualHybridRootMotion_Implementation(
 	float TimeStamp0,
 	FVector_NetQuantize10 InAccel0,
@@ -584,6 +702,35 @@ void UVRCharacterMovementComponent::ServerMoveVR_Implementation(
 		return;
 	}
 
+	// Over this frames movement budget, keep everything in order behind any already deferred moves
+	if (!bIsRunningDeferredServerMoves && (DeferredServerMoves.Num() > 0 || IsOverServerMoveBudget()))
+	{
+		// Queue is full, run everything waiting now so that this move still lands after them
+		if (DeferredServerMoves.Num() >= MaxDeferredServerMoves)
+		{
+			ProcessDeferredServerMoves(true);
+		}
+		else
+		{
+			FVRDeferredServerMove & Deferred = DeferredServerMoves[DeferredServerMoves.AddDefaulted()];
+			Deferred.TimeStamp = TimeStamp;
+			Deferred.InAccel = InAccel;
+			Deferred.ClientLoc = ClientLoc;
+			Deferred.CapsuleLoc = CapsuleLoc;
+			Deferred.ConditionalReps = ConditionalReps;
+			Deferred.LFDiff = LFDiff;
+			Deferred.CapsuleYaw = CapsuleYaw;
+			Deferred.MoveFlags = MoveFlags;
+			Deferred.MoveReps = MoveReps;
+			Deferred.ClientMovementMode = ClientMovementMode;
+			Deferred.bIsOldMove = false;
+			Deferred.ClientMovementBase = MoveReps.ClientMovementBase;
+
+			INC_DWORD_STAT(STAT_VRServerMovesDeferred);
+			return;
+		}
+	}
+
 	FNetworkPredictionData_Server_Character* ServerData = GetPredictionData_Server_Character();
 	check(ServerData);
 
@@ -687,7 +834,11 @@ void UVRCharacterMovementComponent::ServerMoveVR_Implementation(
 			*/
 		}
 
+		UpdateServerNavWalking(DeltaTime);
+
+		const double MoveStartTime = FPlatformTime::Seconds();
 		MoveAutonomous(TimeStamp, DeltaTime, MoveFlags, Accel);
+		AddServerMoveCost(FPlatformTime::Seconds() - MoveStartTime);
 		bHasRequestedVelocity = false;
 	}
 
@@ -696,7 +847,7 @@ void UVRCharacterMovementComponent::ServerMoveVR_Implementation(
 
 	// #TODO: Handle this better at some point? Client also denies it later on during correction (ApplyNetworkMovementMode in base movement)
 	// Pre handling the errors, lets avoid rolling back to/from custom movement modes, they tend to be scripted and this can screw things up
-	const uint8 CurrentPackedMovementMode = PackNetworkMovementMode();
+	const uint8 CurrentPackedMovementMode = PackNetworkMovementModeVR();
 	if (CurrentPackedMovementMode != ClientMovementMode)
 	{
 		TEnumAsByte<EMovementMode> NetMovementMode(MOVE_None);
@@ -715,6 +866,69 @@ void UVRCharacterMovementComponent::ServerMoveVR_Implementation(
 }
 
 
+void UVRCharacterMovementComponent::ProcessDeferredServerMoves(bool bIgnoreBudget)
+{
+	TGuardValue<bool> DeferredGuard(bIsRunningDeferredServerMoves, true);
+
+	// Always make progress on at least one move per frame
+	int32 NumProcessed = 0;
+	while (NumProcessed < DeferredServerMoves.Num() && (NumProcessed == 0 || bIgnoreBudget || !IsOverServerMoveBudget()))
+	{
+		FVRDeferredServerMove & Deferred = DeferredServerMoves[NumProcessed++];
+
+		if (Deferred.bIsOldMove)
+		{
+			ServerMoveOld_Implementation(Deferred.TimeStamp, Deferred.InAccel, Deferred.MoveFlags);
+			continue;
+		}
+
+		Deferred.MoveReps.ClientMovementBase = Deferred.ClientMovementBase.Get();
+
+		ServerMoveVR_Implementation(Deferred.TimeStamp, Deferred.InAccel, Deferred.ClientLoc, Deferred.CapsuleLoc, Deferred.ConditionalReps, Deferred.LFDiff, Deferred.CapsuleYaw, Deferred.MoveFlags, Deferred.MoveReps, Deferred.ClientMovementMode);
+	}
+
+	DeferredServerMoves.RemoveAt(0, NumProcessed, false);
+}
+
+void UVRCharacterMovementComponent::ServerMoveOld_Implementation(float OldTimeStamp, FVector_NetQuantize10 OldAccel, uint8 OldMoveFlags)
+{
+	if (!bIsRunningDeferredServerMoves && DeferredServerMoves.Num() > 0)
+	{
+		// Already waiting in the queue, or older than what is, in which case it would fail the timestamp check anyway
+		if (OldTimeStamp <= DeferredServerMoves.Last().TimeStamp)
+			return;
+
+		if (DeferredServerMoves.Num() >= MaxDeferredServerMoves)
+		{
+			ProcessDeferredServerMoves(true);
+		}
+		else
+		{
+			FVRDeferredServerMove & Deferred = DeferredServerMoves[DeferredServerMoves.AddDefaulted()];
+			Deferred.TimeStamp = OldTimeStamp;
+			Deferred.InAccel = OldAccel;
+			Deferred.MoveFlags = OldMoveFlags;
+			Deferred.bIsOldMove = true;
+
+			INC_DWORD_STAT(STAT_VRServerMovesDeferred);
+			return;
+		}
+	}
+
+	Super::ServerMoveOld_Implementation(OldTimeStamp, OldAccel, OldMoveFlags);
+}
+
+bool UVRCharacterMovementComponent::IsServerMoveDeferred(float TimeStamp, float Tolerance) const
+{
+	for (const FVRDeferredServerMove & Deferred : DeferredServerMoves)
+	{
+		if (FMath::Abs(Deferred.TimeStamp - TimeStamp) <= Tolerance)
+			return true;
+	}
+
+	return false;
+}
+
 void UVRCharacterMovementComponent::CallServerMove
 (
 	const class FSavedMove_Character* NewCMove,
@@ -740,12 +954,6 @@ void UVRCharacterMovementComponent::CallServerMove
 	const FName ClientBaseBone = NewMove->EndBoneName;
 	const FVector SendLocation = MovementBaseUtility::UseRelativeLocation(ClientMovementBase) ? NewMove->SavedRelativeLocation : NewMove->SavedLocation;
 
-	// send old move if it exists
-	if (OldMove)
-	{
-		ServerMoveOld(OldMove->TimeStamp, OldMove->Acceleration, OldMove->GetCompressedFlags());
-	}
-
 	// Pass these in here, don't pass in to old move, it will receive the new move values in dual operations
 	// Will automatically not replicate them if movement base is nullptr (1 bit cost to check this)
 	FVRConditionalMoveRep2 NewMoveConds;
@@ -760,6 +968,23 @@ void UVRCharacterMovementComponent::CallServerMove
 
 	NewMoveConds.ClientYaw = FRotator::CompressAxisToShort(NewMove->SavedControlRotation.Yaw);
 
+	// Everything goes through the one RPC, including the old move
+	if (bUseServerMoveBatching)
+	{
+		FVRServerMoveBatch MoveBatch;
+		BuildServerMoveBatch(NewMove, OldMove, SendLocation, NewMoveConds, MoveBatch);
+		ServerMoveVRBatch(MoveBatch);
+
+		MarkForClientCameraUpdate();
+		return;
+	}
+
+	// send old move if it exists
+	if (OldMove)
+	{
+		ServerMoveOld(OldMove->TimeStamp, OldMove->Acceleration, OldMove->GetCompressedFlags());
+	}
+
 	FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
 	if (const FSavedMove_Character* const PendingMove = ClientData->PendingMove.Get())
 	{
@@ -897,6 +1122,73 @@ void UVRCharacterMovementComponent::CallServerMove
 }
 
 
+void UVRCharacterMovementComponent::BuildServerMoveBatch(const FSavedMove_VRCharacter* NewMove, const FSavedMove_VRCharacter* OldMove, const FVector& SendLocation, const FVRConditionalMoveRep2& NewMoveConds, FVRServerMoveBatch& OutBatch)
+{
+	check(NewMove != nullptr);
+
+	FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
+	const int32 MaxMoves = FMath::Clamp(ServerMoveBatchSize, 2, FVRServerMoveBatch::MaxMoves - 1);
+	const bool bSendPitch = CharacterOwner && CharacterOwner->bUseControllerRotationPitch;
+
+	// Walk back from the newest saved move, these are all unacknowledged so some of them were likely already sent.
+	// Stop at a timestamp reset so that the deltas stay positive.
+	TArray<const FSavedMove_VRCharacter*, TInlineAllocator<FVRServerMoveBatch::MaxMoves>> BatchMoves;
+	BatchMoves.Add(NewMove);
+
+	if (ClientData)
+	{
+		for (int32 i = ClientData->SavedMoves.Num() - 1; i >= 0 && BatchMoves.Num() < MaxMoves; --i)
+		{
+			const FSavedMove_VRCharacter * SavedMove = (const FSavedMove_VRCharacter *)ClientData->SavedMoves[i].Get();
+			if (SavedMove == NewMove)
+				continue;
+
+			if (SavedMove->TimeStamp >= BatchMoves.Last()->TimeStamp)
+				break;
+
+			BatchMoves.Add(SavedMove);
+		}
+	}
+
+	// The oldest important move goes in front if it didn't make it into the window
+	if (OldMove && !BatchMoves.Contains(OldMove) && OldMove->TimeStamp < BatchMoves.Last()->TimeStamp)
+	{
+		BatchMoves.Add(OldMove);
+	}
+
+	OutBatch.Moves.Reset(BatchMoves.Num());
+	for (int32 i = BatchMoves.Num() - 1; i >= 0; --i)
+	{
+		const FSavedMove_VRCharacter * Move = BatchMoves[i];
+		FVRBatchedMove & BatchedMove = OutBatch.Moves[OutBatch.Moves.AddDefaulted()];
+
+		BatchedMove.TimeStamp = Move->TimeStamp;
+		BatchedMove.Acceleration = Move->Acceleration;
+		BatchedMove.CapsuleLoc = Move->VRCapsuleLocation;
+		BatchedMove.ConditionalReps = Move->ConditionalValues;
+		BatchedMove.LFDiff = Move->LFDiff;
+		BatchedMove.CapsuleYaw = FRotator::CompressAxisToShort(Move->VRCapsuleRotation.Yaw);
+		BatchedMove.MoveFlags = Move->GetCompressedFlags();
+
+		// Same packing as the dual RPCs, yaw in the smallest value since pitch is normally zero'd out in VR
+		const uint32 cPitch = bSendPitch ? FRotator::CompressAxisToShort(Move->SavedControlRotation.Pitch) : 0;
+		const uint32 cYaw = FRotator::CompressAxisToShort(Move->SavedControlRotation.Yaw);
+		BatchedMove.View = (cPitch << 16) | (cYaw);
+
+		// Same as the hybrid root motion RPC, moves without root motion are processed as such if the new move has it
+		BatchedMove.bIgnoreRootMotion = (Move != NewMove) && (Move->RootMotionMontage == NULL) && (NewMove->RootMotionMontage != NULL);
+	}
+
+	OutBatch.ClientLoc = SendLocation;
+	OutBatch.MoveReps = NewMoveConds;
+	OutBatch.ClientMovementMode = NewMove->EndPackedMovementMode;
+}
+
+void UVRCharacterMovementComponent::ServerMoveVRBatch(const FVRServerMoveBatch& MoveBatch)
+{
+	((AVRCharacter*)CharacterOwner)->ServerMoveVRBatch(MoveBatch);
+}
+
 void UVRCharacterMovementComponent::ServerMoveVR(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	((AVRCharacter*)CharacterOwner)->ServerMoveVR(TimeStamp, InAccel, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, CompressedMoveFlags, MoveReps, ClientMovementMode);
@@ -944,6 +1236,7 @@ bool UVRCharacterMovementComponent::ShouldCheckForValidLandingSpot(float DeltaTi
 void UVRCharacterMovementComponent::PhysWalking(float deltaTime, int32 Iterations)
 {
 	SCOPE_CYCLE_COUNTER(STAT_CharPhysWalking);
+	VR_SCOPE_MOVEMENT_PHASE(PhysWalking);
 
 	if (deltaTime < MIN_TICK_TIME)
 	{
@@ -1311,7 +1604,7 @@ void UVRCharacterMovementComponent::ReplicateMoveToServer(float DeltaTime, const
 	// do not combine moves which have different TimeStamps (before and after reset).
 	if (const FSavedMove_Character* PendingMove = ClientData->PendingMove.Get())
 	{
-		if (bAllowMovementMerging && !PendingMove->bOldTimeStampBeforeReset && PendingMove->CanCombineWith(NewMovePtr, CharacterOwner, ClientData->MaxMoveDeltaTime * CharacterOwner->GetActorTimeDilation()))
+		if ((bAllowMovementMerging || ShouldForceMoveCombining(ClientData)) && !PendingMove->bOldTimeStampBeforeReset && PendingMove->CanCombineWith(NewMovePtr, CharacterOwner, ClientData->MaxMoveDeltaTime * CharacterOwner->GetActorTimeDilation()))
 		{
 			//SCOPE_CYCLE_COUNTER(STAT_CharacterMovementCombineNetMove);
 
@@ -1472,6 +1765,37 @@ UVRCharacterMovementComponent::UVRCharacterMovementComponent(const FObjectInitia
 	bUseClientControlRotation = false;
 	bAllowMovementMerging = false;
 	bRequestedMoveUseAcceleration = false;
+	bUseServerMoveBatching = false;
+	ServerMoveBatchSize = 4;
+
+	bUseProxySignificance = false;
+	ProxyFullDistance = 1000.0f;
+	ProxyInterpolateDistance = 5000.0f;
+	ProxyInterpolateScreenSize = 0.02f;
+	ProxyReducedUpdateRate = 30.0f;
+	ProxySignificanceInterval = 0.25f;
+	ProxySignificance = EVRProxySignificance::ProxySig_Full;
+	ProxySignificanceTimer = 0.0f;
+	ProxyAccumulatedDelta = 0.0f;
+
+	bIsRunningDeferredServerMoves = false;
+
+	bUseServerNavWalking = false;
+	ServerNavWalkingObstacleDistance = 100.0f;
+	ServerNavWalkingCheckInterval = 0.25f;
+	ServerNavWalkingTimer = 0.0f;
+	bSavedProjectNavMeshWalking = false;
+	bSavedSweepWhileNavWalking = true;
+
+	bUseAdaptiveCorrectionTolerance = false;
+	AdaptiveCorrectionErrorScale = 1.5f;
+	AdaptiveCorrectionPingScale = 0.02f;
+	AdaptiveCorrectionMaxTolerance = 15.0f;
+	CorrectionDedupDistance = 1.0f;
+	ClientErrorAverage = 0.0f;
+	LastCorrectionLoc = FVector::ZeroVector;
+	LastCorrectionVel = FVector::ZeroVector;
+	LastCorrectionTime = -1.0f;
 }
 
 
@@ -1480,6 +1804,12 @@ void UVRCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTi
 	if (!HasValidData())
 	{
 		return;
+	}
+
+	// Catch up on client moves that went over budget last frame before anything new comes in
+	if (DeferredServerMoves.Num() > 0 && CharacterOwner && CharacterOwner->Role == ROLE_Authority)
+	{
+		ProcessDeferredServerMoves();
 	}
 
 	if (CharacterOwner && CharacterOwner->IsLocallyControlled())
@@ -1512,6 +1842,8 @@ void UVRCharacterMovementComponent::ApplyRepulsionForce(float DeltaSeconds)
 		const TArray<FOverlapInfo>& Overlaps = UpdatedPrimitive->GetOverlapInfos();
 		if (Overlaps.Num() > 0)
 		{
+			SCOPE_CYCLE_COUNTER(STAT_VRRepulsionForce);
+
 			FCollisionQueryParams QueryParams;
 			QueryParams.bReturnFaceIndex = false;
 			QueryParams.bReturnPhysicalMaterial = false;
@@ -1528,6 +1860,14 @@ void UVRCharacterMovementComponent::ApplyRepulsionForce(float DeltaSeconds)
 			else
 				MyLocation = UpdatedPrimitive->GetComponentLocation();
 
+			// Gather every simulating body first so that the distance pass runs over flat arrays
+			TArray<FBodyInstance*, TInlineAllocator<32>> Bodies;
+			TArray<float, TInlineAllocator<32>> OffsetX;
+			TArray<float, TInlineAllocator<32>> OffsetY;
+			TArray<float, TInlineAllocator<32>> OffsetZ;
+			TArray<float, TInlineAllocator<32>> VelocityX;
+			TArray<float, TInlineAllocator<32>> VelocityY;
+
 			for (int32 i = 0; i < Overlaps.Num(); i++)
 			{
 				const FOverlapInfo& Overlap = Overlaps[i];
@@ -1562,10 +1902,83 @@ void UVRCharacterMovementComponent::ApplyRepulsionForce(float DeltaSeconds)
 					continue;
 				}
 
-				FTransform BodyTransform = OverlapBody->GetUnrealWorldTransform();
+				const FVector BodyLocation = OverlapBody->GetUnrealWorldTransform().GetLocation() - MyLocation;
+				const FVector BodyVelocity = OverlapBody->GetUnrealWorldVelocity();
+
+				Bodies.Add(OverlapBody);
+				OffsetX.Add(BodyLocation.X);
+				OffsetY.Add(BodyLocation.Y);
+				OffsetZ.Add(BodyLocation.Z);
+				VelocityX.Add(BodyVelocity.X * DeltaSeconds);
+				VelocityY.Add(BodyVelocity.Y * DeltaSeconds);
+			}
+
+			const int32 NumBodies = Bodies.Num();
+			if (NumBodies < 1)
+				return;
+
+			// The capsule is treated as upright below, anything else goes through the exact traces
+			const bool bCapsuleUpright = UpdatedPrimitive->GetComponentQuat().GetUpVector().Z > 0.999f;
+
+			// Bodies within this much of the capsule surface (or the stop distance) get the exact trace instead of the analytic one
+			const float ExactQueryBand = StopBodyDistance * 2.0f;
+			const float CylinderHalfHeight = FMath::Max(CapsuleHalfHeight - CapsuleRadius, 0.0f);
+
+			enum ERepulsionAction : uint8
+			{
+				Repulse_None,
+				Repulse_Push,
+				Repulse_Exact
+			};
+
+			TArray<uint8, TInlineAllocator<32>> Actions;
+			Actions.AddUninitialized(NumBodies);
+
+			// Analytic horizontal distance to the capsule surface at each bodies height, branch free so it vectorizes
+			for (int32 i = 0; i < NumBodies; i++)
+			{
+				const float CapZ = FMath::Max(FMath::Abs(OffsetZ[i]) - CylinderHalfHeight, 0.0f);
+				const float SurfaceRadiusSq = FMath::Square(CapsuleRadius) - FMath::Square(CapZ);
+				const float SurfaceRadius = FMath::Sqrt(FMath::Max(SurfaceRadiusSq, 0.0f));
+				const float Dist = FMath::Sqrt(FMath::Square(OffsetX[i]) + FMath::Square(OffsetY[i]));
+
+				// Scale that takes the body offset onto the capsule surface, the hit location relative to the capsule axis
+				const float Scale = SurfaceRadius / FMath::Max(Dist, KINDA_SMALL_NUMBER);
+				const float HitX = OffsetX[i] * Scale;
+				const float HitY = OffsetY[i] * Scale;
+
+				const float DistanceNow = FMath::Square(HitX - OffsetX[i]) + FMath::Square(HitY - OffsetY[i]);
+				const float DistanceLater = FMath::Square(HitX - (OffsetX[i] + VelocityX[i])) + FMath::Square(HitY - (OffsetY[i] + VelocityY[i]));
+
+				const bool bNearSurface = SurfaceRadiusSq <= 0.0f || FMath::Abs(Dist - SurfaceRadius) <= ExactQueryBand;
+				const bool bInside = Dist < SurfaceRadius;
+
+				Actions[i] = (bNearSurface || !bCapsuleUpright) ? Repulse_Exact : ((bInside || DistanceLater <= DistanceNow) ? Repulse_Push : Repulse_None);
+			}
+
+			// Forces are applied once everything is classified
+			for (int32 i = 0; i < NumBodies; i++)
+			{
+				FBodyInstance* OverlapBody = Bodies[i];
+				const FVector BodyLocation = MyLocation + FVector(OffsetX[i], OffsetY[i], OffsetZ[i]);
+
+				if (Actions[i] == Repulse_Push)
+				{
+					INC_DWORD_STAT(STAT_VRRepulsionAnalytic);
+
+					// Both the surface hit and the inside case end up centered on the capsule at the bodies (clamped) height
+					const FVector ForceCenter(MyLocation.X, MyLocation.Y, FMath::Clamp(BodyLocation.Z, MyLocation.Z - CapsuleHalfHeight, MyLocation.Z + CapsuleHalfHeight));
+					OverlapBody->AddRadialForceToBody(ForceCenter, RepulsionForceRadius, RepulsionForce * Mass, ERadialImpulseFalloff::RIF_Constant);
+					continue;
+				}
+				else if (Actions[i] != Repulse_Exact)
+				{
+					INC_DWORD_STAT(STAT_VRRepulsionAnalytic);
+					continue;
+				}
 
-				FVector BodyVelocity = OverlapBody->GetUnrealWorldVelocity();
-				FVector BodyLocation = BodyTransform.GetLocation();
+				INC_DWORD_STAT(STAT_VRRepulsionExact);
+				const FVector BodyVelocity(VelocityX[i], VelocityY[i], 0.0f);
 
 				// Trace to get the hit location on the capsule
 				FHitResult Hit;
@@ -1584,7 +1997,7 @@ void UVRCharacterMovementComponent::ApplyRepulsionForce(float DeltaSeconds)
 				}
 
 				const float DistanceNow = (HitLoc - BodyLocation).SizeSquared2D();
-				const float DistanceLater = (HitLoc - (BodyLocation + BodyVelocity * DeltaSeconds)).SizeSquared2D();
+				const float DistanceLater = (HitLoc - (BodyLocation + BodyVelocity)).SizeSquared2D();
 
 				if (bHasHit && DistanceNow < StopBodyDistance && !bIsPenetrating)
 				{
@@ -1673,6 +2086,9 @@ bool UVRCharacterMovementComponent::SafeMoveUpdatedComponent(const FVector& Delt
 
 void UVRCharacterMovementComponent::MoveAlongFloor(const FVector& InVelocity, float DeltaSeconds, FStepDownResult* OutStepDownResult)
 {
+	SCOPE_CYCLE_COUNTER(STAT_VRMoveAlongFloor);
+	VR_SCOPE_MOVEMENT_PHASE(MoveAlongFloor);
+
 	if (!CurrentFloor.IsWalkableFloor())
 	{
 		return;
@@ -1747,6 +2163,7 @@ void UVRCharacterMovementComponent::MoveAlongFloor(const FVector& InVelocity, fl
 bool UVRCharacterMovementComponent::StepUp(const FVector& GravDir, const FVector& Delta, const FHitResult &InHit, FStepDownResult* OutStepDownResult)
 {
 	SCOPE_CYCLE_COUNTER(STAT_CharStepUp);
+	VR_SCOPE_MOVEMENT_PHASE(StepUp);
 
 	if (!CanStepUp(InHit) || MaxStepHeight <= 0.f)
 	{
@@ -1984,6 +2401,7 @@ bool UVRCharacterMovementComponent::IsWithinClimbingEdgeTolerance(const FVector&
 bool UVRCharacterMovementComponent::VRClimbStepUp(const FVector& GravDir, const FVector& Delta, const FHitResult &InHit, FStepDownResult* OutStepDownResult)
 {
 	SCOPE_CYCLE_COUNTER(STAT_CharStepUp);
+	VR_SCOPE_MOVEMENT_PHASE(StepUp);
 
 	if (!CanStepUp(InHit) || MaxStepHeight <= 0.f)
 	{
@@ -2373,6 +2791,7 @@ FVector UVRCharacterMovementComponent::GetImpartedMovementBaseVelocity() const
 void UVRCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult, bool bCanUseCachedLocation, const FHitResult* DownwardSweepResult) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_CharFindFloor);
+	VR_SCOPE_MOVEMENT_PHASE(FindFloor);
 	//UE_LOG(LogVRCharacterMovement, Warning, TEXT("Find Floor"));
 	// No collision, no floor...
 	if (!HasValidData() || !UpdatedComponent->IsQueryCollisionEnabled())
@@ -2757,6 +3176,125 @@ bool UVRCharacterMovementComponent::TryToLeaveNavWalking()
 	return bCanTeleport;
 }
 
+void UVRCharacterMovementComponent::SetNavWalkingPhysics(bool bEnable)
+{
+	// Nav walking normally ignores WorldStatic / WorldDynamic on the capsule, server nav walking only drops the movement sweeps.
+	// Otherwise projectiles, weapon traces and triggers would pass through remote players whenever they were on the navmesh.
+	if (bIsServerNavWalking)
+		return;
+
+	Super::SetNavWalkingPhysics(bEnable);
+}
+
+void UVRCharacterMovementComponent::UpdateServerNavWalking(float DeltaTime)
+{
+	// Nav walking drops itself when it runs off of the navmesh or starts falling
+	if (bIsServerNavWalking && (MovementMode != MOVE_NavWalking || !bUseServerNavWalking))
+	{
+		EndServerNavWalking();
+	}
+
+	if (!bUseServerNavWalking || !CharacterOwner || CharacterOwner->IsLocallyControlled())
+		return;
+
+	ServerNavWalkingTimer -= DeltaTime;
+	if (ServerNavWalkingTimer > 0.0f)
+		return;
+
+	ServerNavWalkingTimer = ServerNavWalkingCheckInterval;
+
+	if (bIsServerNavWalking)
+	{
+		if (HasServerNavWalkingObstacle())
+		{
+			EndServerNavWalking();
+		}
+	}
+	else if (MovementMode == MOVE_Walking && !HasServerNavWalkingObstacle())
+	{
+		FNavLocation NavLocation;
+		if (FindNavFloor(GetActorFeetLocationVR(), NavLocation))
+		{
+			// Projecting keeps the height on the real floor so that the client (still sweeping) agrees with us
+			bSavedProjectNavMeshWalking = bProjectNavMeshWalking;
+			bSavedSweepWhileNavWalking = bSweepWhileNavWalking;
+			bProjectNavMeshWalking = true;
+			bSweepWhileNavWalking = false;
+
+			bIsServerNavWalking = true;
+			SetMovementMode(MOVE_NavWalking);
+		}
+	}
+}
+
+void UVRCharacterMovementComponent::EndServerNavWalking()
+{
+	ServerNavWalkingTimer = ServerNavWalkingCheckInterval;
+
+	if (MovementMode == MOVE_NavWalking)
+	{
+		// OnMovementModeChanged runs TryToLeaveNavWalking for us, if there was no collision free spot
+		// then go back to nav walking and try again on the next check
+		bWantsToLeaveNavWalking = false;
+		SetMovementMode(MOVE_Walking);
+
+		if (bWantsToLeaveNavWalking)
+		{
+			SetMovementMode(MOVE_NavWalking);
+			return;
+		}
+	}
+
+	bIsServerNavWalking = false;
+	bProjectNavMeshWalking = bSavedProjectNavMeshWalking;
+	bSweepWhileNavWalking = bSavedSweepWhileNavWalking;
+
+	// Otherwise landing from a fall would put us straight back into untracked nav walking
+	if (GetGroundMovementMode() == MOVE_NavWalking)
+	{
+		SetGroundMovementMode(MOVE_Walking);
+	}
+}
+
+bool UVRCharacterMovementComponent::HasServerNavWalkingObstacle() const
+{
+	UWorld * World = GetWorld();
+	if (!World || !CharacterOwner)
+		return true;
+
+	float PawnRadius, PawnHalfHeight;
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(PawnRadius, PawnHalfHeight);
+
+	FVector CapsuleLocation;
+	if (VRRootCapsule)
+		CapsuleLocation = VRRootCapsule->OffsetComponentToWorld.GetLocation();
+	else
+		CapsuleLocation = UpdatedComponent->GetComponentLocation();
+
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	ObjectParams.AddObjectTypesToQuery(ECC_PhysicsBody);
+	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	ObjectParams.AddObjectTypesToQuery(ECC_Vehicle);
+	ObjectParams.AddObjectTypesToQuery(ECC_Destructible);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ServerNavWalkingObstacles), false, CharacterOwner);
+
+	TArray<FOverlapResult> Overlaps;
+	World->OverlapMultiByObjectType(Overlaps, CapsuleLocation, FQuat::Identity, ObjectParams,
+		FCollisionShape::MakeCapsule(PawnRadius + ServerNavWalkingObstacleDistance, PawnHalfHeight), QueryParams);
+
+	// Anything that can actually move needs real collision, static world dynamic props are fine
+	for (const FOverlapResult & Overlap : Overlaps)
+	{
+		const UPrimitiveComponent * OverlapComp = Overlap.Component.Get();
+		if (OverlapComp && OverlapComp->Mobility == EComponentMobility::Movable && OverlapComp->IsCollisionEnabled())
+			return true;
+	}
+
+	return false;
+}
+
 void UVRCharacterMovementComponent::PhysFlying(float deltaTime, int32 Iterations)
 {
 	if (deltaTime < MIN_TICK_TIME)
@@ -3608,6 +4146,12 @@ void UVRCharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 		return;
 	}
 
+	// Distant proxies skip or slow down their simulation
+	if (bIsSimulatedProxy && !UpdateProxySignificance(DeltaSeconds))
+	{
+		return;
+	}
+
 	FVector OldVelocity;
 	FVector OldLocation;
 
@@ -3758,6 +4302,108 @@ void UVRCharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 	LastUpdateLocation = UpdatedComponent ? UpdatedComponent->GetComponentLocation() : FVector::ZeroVector;
 	LastUpdateRotation = UpdatedComponent ? UpdatedComponent->GetComponentQuat() : FQuat::Identity;
 	LastUpdateVelocity = Velocity;
+}
+
+bool UVRCharacterMovementComponent::UpdateProxySignificance(float & DeltaSeconds)
+{
+	if (!bUseProxySignificance || !CharacterMovementComponentStatics::bEnableProxySignificance)
+	{
+		ProxySignificance = EVRProxySignificance::ProxySig_Full;
+		ProxyAccumulatedDelta = 0.0f;
+		return true;
+	}
+
+	ProxySignificanceTimer -= DeltaSeconds;
+	if (ProxySignificanceTimer <= 0.0f)
+	{
+		ProxySignificanceTimer = ProxySignificanceInterval;
+
+		const EVRProxySignificance NewSignificance = EvaluateProxySignificance();
+		if (NewSignificance != ProxySignificance)
+		{
+			// Coming back up from interpolating, the floor is stale
+			if (ProxySignificance == EVRProxySignificance::ProxySig_Interpolated)
+				bForceNextFloorCheck = true;
+
+			ProxySignificance = NewSignificance;
+		}
+	}
+
+	switch (ProxySignificance)
+	{
+	case EVRProxySignificance::ProxySig_Reduced:
+	{
+		INC_DWORD_STAT(STAT_VRProxiesReduced);
+		ProxyAccumulatedDelta += DeltaSeconds;
+
+		// Net updates are always handled right away so movement modes and floors stay in sync
+		if (!bNetworkUpdateReceived && ProxyAccumulatedDelta < 1.0f / FMath::Max(ProxyReducedUpdateRate, 1.0f))
+			return false;
+
+		DeltaSeconds = FMath::Min(ProxyAccumulatedDelta, MaxSimulationTimeStep * MaxSimulationIterations);
+		ProxyAccumulatedDelta = 0.0f;
+		return true;
+	}break;
+
+	case EVRProxySignificance::ProxySig_Interpolated:
+	{
+		INC_DWORD_STAT(STAT_VRProxiesInterpolated);
+		ProxyAccumulatedDelta = 0.0f;
+
+		if (bNetworkUpdateReceived)
+			return true;
+
+		SimulateInterpolatedProxy(DeltaSeconds);
+		return false;
+	}break;
+
+	case EVRProxySignificance::ProxySig_Full:
+	default:
+	{
+		INC_DWORD_STAT(STAT_VRProxiesFull);
+		ProxyAccumulatedDelta = 0.0f;
+		return true;
+	}break;
+	}
+}
+
+EVRProxySignificance UVRCharacterMovementComponent::EvaluateProxySignificance() const
+{
+	FVector ViewLocation;
+	float TanHalfFOV;
+
+	// No local view (spectating / no player), nothing to base it on
+	if (!UpdatedComponent || !CharacterMovementComponentStatics::GetProxyViewer(GetWorld(), ViewLocation, TanHalfFOV))
+		return EVRProxySignificance::ProxySig_Full;
+
+	const float Distance = FVector::Dist(ViewLocation, UpdatedComponent->GetComponentLocation());
+	if (Distance <= ProxyFullDistance)
+		return EVRProxySignificance::ProxySig_Full;
+
+	// Rough size of the capsule on screen
+	const float ScreenSize = UpdatedComponent->Bounds.SphereRadius / FMath::Max(Distance * TanHalfFOV, KINDA_SMALL_NUMBER);
+
+	if (Distance >= ProxyInterpolateDistance || ScreenSize < ProxyInterpolateScreenSize)
+		return EVRProxySignificance::ProxySig_Interpolated;
+
+	return EVRProxySignificance::ProxySig_Reduced;
+}
+
+void UVRCharacterMovementComponent::SimulateInterpolatedProxy(float DeltaSeconds)
+{
+	// Only dead reckon along the ground, anything else just holds until the next net update
+	if (IsMovingOnGround() && !CharacterOwner->bSimGravityDisabled && !CharacterOwner->ReplicatedMovement.LinearVelocity.IsZero())
+	{
+		const FVector Delta = FVector(Velocity.X, Velocity.Y, 0.0f) * DeltaSeconds;
+		if (!Delta.IsNearlyZero())
+		{
+			UpdatedComponent->MoveComponent(Delta, UpdatedComponent->GetComponentQuat(), false, nullptr, MOVECOMP_NoFlags, ETeleportType::TeleportPhysics);
+		}
+	}
+
+	LastUpdateLocation = UpdatedComponent->GetComponentLocation();
+	LastUpdateRotation = UpdatedComponent->GetComponentQuat();
+	LastUpdateVelocity = Velocity;
 }
 
 void UVRCharacterMovementComponent::MoveSmooth(const FVector& InVelocity, const float DeltaSeconds, FStepDownResult* OutStepDownResult)
@@ -3824,6 +4470,35 @@ void UVRCharacterMovementComponent::MoveSmooth(const FVector& InVelocity, const
 	}
 }
 
+float UVRCharacterMovementComponent::GetAdaptiveCorrectionTolerance() const
+{
+	const AGameNetworkManager* GameNetworkManager = GetDefault<AGameNetworkManager>();
+	const float BaseTolerance = FMath::Sqrt(GameNetworkManager->MAXPOSITIONERRORSQUARED);
+
+	const APlayerState * OwnerPlayerState = CharacterOwner ? CharacterOwner->PlayerState : nullptr;
+	const float Ping = OwnerPlayerState ? OwnerPlayerState->ExactPing : 0.0f;
+
+	return FMath::Clamp(BaseTolerance + (ClientErrorAverage * AdaptiveCorrectionErrorScale) + (Ping * AdaptiveCorrectionPingScale), BaseTolerance, FMath::Max(BaseTolerance, AdaptiveCorrectionMaxTolerance));
+}
+
+int32 UVRCharacterMovementComponent::GetCorrectionsPerMinute() const
+{
+	const UWorld * World = GetWorld();
+	if (!World)
+		return 0;
+
+	const float MinuteAgo = World->GetTimeSeconds() - 60.0f;
+
+	int32 Count = 0;
+	for (float CorrectionTime : RecentCorrectionTimes)
+	{
+		if (CorrectionTime >= MinuteAgo)
+			++Count;
+	}
+
+	return Count;
+}
+
 void UVRCharacterMovementComponent::SendClientAdjustment()
 {
 	if (!HasValidData())
@@ -3857,11 +4532,43 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 			FMath::Min(NetworkMinTimeBetweenClientAdjustmentsLargeCorrection, NetworkMinTimeBetweenClientAdjustments) :
 			FMath::Max(NetworkMinTimeBetweenClientAdjustmentsLargeCorrection, NetworkMinTimeBetweenClientAdjustments);
 
+		// The client is probably still replaying the last correction if this one matches it, don't send it again until it has had time to arrive
+		bool bDuplicateCorrection = false;
+		if (CorrectionDedupDistance > 0.0f && LastCorrectionTime >= 0.0f && !bNetworkLargeClientCorrection)
+		{
+			const APlayerState * OwnerPlayerState = CharacterOwner->PlayerState;
+			const float RoundTripTime = OwnerPlayerState ? (OwnerPlayerState->ExactPing * 0.001f) : 0.1f;
+
+			bDuplicateCorrection = (CurrentTime - LastCorrectionTime) < FMath::Max(RoundTripTime * 1.5f, 0.1f) &&
+				LastCorrectionBase.Get() == ServerData->PendingAdjustment.NewBase &&
+				LastCorrectionLoc.Equals(ServerData->PendingAdjustment.NewLoc, CorrectionDedupDistance) &&
+				LastCorrectionVel.Equals(ServerData->PendingAdjustment.NewVel, CorrectionDedupDistance);
+		}
+
+		if (bDuplicateCorrection)
+		{
+			INC_DWORD_STAT(STAT_VRCorrectionsDeduplicated);
+		}
 		// Check if correction is throttled based on time limit between updates.
-		if (CurrentTime - ServerLastClientAdjustmentTime > AdjustmentTimeThreshold)
+		else if (CurrentTime - ServerLastClientAdjustmentTime > AdjustmentTimeThreshold)
 		{
 			ServerLastClientAdjustmentTime = CurrentTime;
 
+			LastCorrectionTime = CurrentTime;
+			LastCorrectionLoc = ServerData->PendingAdjustment.NewLoc;
+			LastCorrectionVel = ServerData->PendingAdjustment.NewVel;
+			LastCorrectionBase = ServerData->PendingAdjustment.NewBase;
+
+			// Only the last minute is kept, times are in order so the old ones are at the front
+			int32 NumExpired = 0;
+			while (NumExpired < RecentCorrectionTimes.Num() && RecentCorrectionTimes[NumExpired] < CurrentTime - 60.0f)
+			{
+				++NumExpired;
+			}
+			RecentCorrectionTimes.RemoveAt(0, NumExpired, false);
+			RecentCorrectionTimes.Add(CurrentTime);
+			INC_DWORD_STAT(STAT_VRCorrectionsSent);
+
 			const bool bIsPlayingNetworkedRootMotionMontage = CharacterOwner->IsPlayingNetworkedRootMotionMontage();
 			if (HasRootMotionSources())
 			{
@@ -3880,7 +4587,7 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 					ServerData->PendingAdjustment.NewBaseBoneName,
 					ServerData->PendingAdjustment.NewBase != NULL,
 					ServerData->PendingAdjustment.bBaseRelativePosition,
-					PackNetworkMovementMode()
+					PackNetworkMovementModeVR()
 				);
 			}
 			else if (bIsPlayingNetworkedRootMotionMontage)
@@ -3898,7 +4605,7 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 					ServerData->PendingAdjustment.NewBaseBoneName,
 					ServerData->PendingAdjustment.NewBase != NULL,
 					ServerData->PendingAdjustment.bBaseRelativePosition,
-					PackNetworkMovementMode()
+					PackNetworkMovementModeVR()
 				);
 			}
 			else if (ServerData->PendingAdjustment.NewVel.IsZero())
@@ -3912,7 +4619,7 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 					ServerData->PendingAdjustment.NewBaseBoneName,
 					ServerData->PendingAdjustment.NewBase != NULL,
 					ServerData->PendingAdjustment.bBaseRelativePosition,
-					PackNetworkMovementMode()
+					PackNetworkMovementModeVR()
 				);
 			}
 			else
@@ -3927,7 +4634,7 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 					ServerData->PendingAdjustment.NewBaseBoneName,
 					ServerData->PendingAdjustment.NewBase != NULL,
 					ServerData->PendingAdjustment.bBaseRelativePosition,
-					PackNetworkMovementMode()
+					PackNetworkMovementModeVR()
 				);
 			}
 		}
@@ -4107,10 +4814,15 @@ void UVRCharacterMovementComponent::ClientAdjustPositionVR_Implementation
 
 	UpdateComponentVelocity();
 	ClientData->bUpdatePosition = true;
+
+	ApplyClientReplayBudget();
 }
 
 bool UVRCharacterMovementComponent::ServerCheckClientErrorVR(float ClientTimeStamp, float DeltaTime, const FVector& Accel, const FVector& ClientWorldLocation, float ClientYaw, const FVector& RelativeClientLocation, UPrimitiveComponent* ClientMovementBase, FName ClientBaseBoneName, uint8 ClientMovementMode)
 {
+	SCOPE_CYCLE_COUNTER(STAT_VRServerCheckClientError);
+	VR_SCOPE_MOVEMENT_PHASE(ServerCheckClientError);
+
 	// Check location difference against global setting
 	if (!bIgnoreClientMovementErrorChecksAndCorrection)
 	{
@@ -4125,7 +4837,24 @@ bool UVRCharacterMovementComponent::ServerCheckClientErrorVR(float ClientTimeSta
 		}
 #endif
 		const AGameNetworkManager* GameNetworkManager = (const AGameNetworkManager*)(AGameNetworkManager::StaticClass()->GetDefaultObject());
-		if (GameNetworkManager->ExceedsAllowablePositionError(LocDiff))
+
+		bool bExceedsPositionError = false;
+		if (bUseAdaptiveCorrectionTolerance)
+		{
+			// Only errors we let through feed the average, so real desyncs (and the corrections they cause) don't inflate the tolerance that catches them.
+			// Also capped at the base tolerance, otherwise accepted errors near the edge would keep walking the tolerance up to the max.
+			const float ErrorSize = LocDiff.Size();
+			bExceedsPositionError = ErrorSize > GetAdaptiveCorrectionTolerance();
+
+			if (!bExceedsPositionError)
+				ClientErrorAverage = FMath::Lerp(ClientErrorAverage, FMath::Min(ErrorSize, FMath::Sqrt(GameNetworkManager->MAXPOSITIONERRORSQUARED)), 0.1f);
+		}
+		else
+		{
+			bExceedsPositionError = GameNetworkManager->ExceedsAllowablePositionError(LocDiff);
+		}
+
+		if (bExceedsPositionError)
 		{
 			bNetworkLargeClientCorrection = (LocDiff.SizeSquared() > FMath::Square(NetworkLargeClientCorrectionDistance));
 			return true;
@@ -4154,7 +4883,7 @@ bool UVRCharacterMovementComponent::ServerCheckClientErrorVR(float ClientTimeSta
 	}
 
 	// Check for disagreement in movement mode
-	const uint8 CurrentPackedMovementMode = PackNetworkMovementMode();
+	const uint8 CurrentPackedMovementMode = PackNetworkMovementModeVR();
 	if (CurrentPackedMovementMode != ClientMovementMode)
 	{
 		return true;
@@ -4252,7 +4981,7 @@ void UVRCharacterMovementComponent::ServerMoveHandleClientErrorVR(float ClientTi
 		ServerData->PendingAdjustment.DeltaTime = DeltaTime;
 		ServerData->PendingAdjustment.TimeStamp = ClientTimeStamp;
 		ServerData->PendingAdjustment.bAckGoodMove = false;
-		ServerData->PendingAdjustment.MovementMode = PackNetworkMovementMode();
+		ServerData->PendingAdjustment.MovementMode = PackNetworkMovementModeVR();
 
 		//PerfCountersIncrement(PerfCounter_NumServerMoveCorrections);
 	}
@@ -4262,7 +4991,7 @@ void UVRCharacterMovementComponent::ServerMoveHandleClientErrorVR(float ClientTi
 		if (GameNetworkManager->ClientAuthorativePosition)
 		{
 			const FVector LocDiff = UpdatedComponent->GetComponentLocation() - ClientLoc; //-V595
-			if (!LocDiff.IsZero() || ClientMovementMode != PackNetworkMovementMode() || GetMovementBase() != ClientMovementBase || (CharacterOwner && CharacterOwner->GetBasedMovement().BoneName != ClientBaseBoneName))
+			if (!LocDiff.IsZero() || ClientMovementMode != PackNetworkMovementModeVR() || GetMovementBase() != ClientMovementBase || (CharacterOwner && CharacterOwner->GetBasedMovement().BoneName != ClientBaseBoneName))
 			{
 				// Just set the position. On subsequent moves we will resolve initially overlapping conditions.
 				UpdatedComponent->SetWorldLocation(ClientLoc, false); //-V595
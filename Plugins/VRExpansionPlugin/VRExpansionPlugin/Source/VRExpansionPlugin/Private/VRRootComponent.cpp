@@ -22,6 +22,30 @@ DECLARE_CYCLE_STAT(TEXT("VRRootMovement"), STAT_VRRootMovement, STATGROUP_VRRoot
 
 typedef TArray<FOverlapInfo, TInlineAllocator<3>> TInlineOverlapInfoArray;
 
+// Hash key for an overlap, matches FOverlapInfo's equality (component and body index)
+struct FVROverlapKey
+{
+	const UPrimitiveComponent* Component;
+	int32 Item;
+
+	FVROverlapKey(const FOverlapInfo& Info)
+		: Component(Info.OverlapInfo.Component.Get())
+		, Item(Info.GetBodyIndex())
+	{}
+
+	bool operator==(const FVROverlapKey& Other) const
+	{
+		return Component == Other.Component && Item == Other.Item;
+	}
+
+	friend uint32 GetTypeHash(const FVROverlapKey& Key)
+	{
+		return HashCombine(PointerHash(Key.Component), ::GetTypeHash(Key.Item));
+	}
+};
+
+typedef TMap<FVROverlapKey, int32, TInlineSetAllocator<16>> TVROverlapIndexMap;
+
 // Helper to see if two components can possibly generate overlaps with each other.
 FORCEINLINE_DEBUGGABLE static bool CanComponentsGenerateOverlap(const UPrimitiveComponent* MyComponent, /*const*/ UPrimitiveComponent* OtherComp)
 {
@@ -297,8 +321,23 @@ UVRRootComponent::UVRRootComponent(const FObjectInitializer& ObjectInitializer)
 
 	bAllowSimulatingCollision = false;
 	bUseWalkingCollisionOverride = false;
+	bUseOverlapCandidateCache = false;
+	OverlapCandidateMargin = 25.0f;
+	OverlapCandidateMaxAge = 1.0f;
+	OverlapCandidateBox.Init();
+	OverlapCandidateTime = 0.0f;
 	WalkingCollisionOverride = ECollisionChannel::ECC_Pawn;
 
+	bCoalesceHMDSweeps = false;
+	HMDSweepCoalesceDistance = 2.0f;
+	HMDSweepProximityDistance = 10.0f;
+	HMDSweepProximityInterval = 0.2f;
+	CoalescedSweepStart = FVector::ZeroVector;
+	bHasCoalescedSweep = false;
+	ProximityCheckLocation = FVector::ZeroVector;
+	LastProximityCheckTime = -1.0f;
+	bCachedNearGeometry = true;
+
 	bCalledUpdateTransform = false;
 
 	CanCharacterStepUpOn = ECB_No;
@@ -525,8 +564,35 @@ void UVRRootComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 						bAllowWalkingCollision = true;
 				}
 
+				if (bAllowWalkingCollision && bCoalesceHMDSweeps)
+				{
+					// Sweep from where the last sweep ended, stored relative to the capsule so character movement in between doesn't count
+					if (!bHasCoalescedSweep)
+					{
+						CoalescedSweepStart = GetComponentTransform().InverseTransformPosition(LastPosition);
+						bHasCoalescedSweep = true;
+					}
+
+					const FVector CoalescedMove = GetComponentTransform().InverseTransformPosition(OffsetComponentToWorld.GetLocation()) - CoalescedSweepStart;
+					if (CoalescedMove.SizeSquared2D() < FMath::Square(HMDSweepCoalesceDistance) && !IsNearHMDSweepGeometry(Params, ResponseParam))
+					{
+						bAllowWalkingCollision = false;
+						INC_DWORD_STAT(STAT_VRRootHMDSweepsCoalesced);
+					}
+					else
+					{
+						LastPosition = GetComponentTransform().TransformPosition(CoalescedSweepStart);
+						bHasCoalescedSweep = false;
+					}
+				}
+				else
+					bHasCoalescedSweep = false;
+
 				if (bAllowWalkingCollision)
+				{
+					INC_DWORD_STAT(STAT_VRRootHMDSweeps);
 					bBlockingHit = GetWorld()->SweepSingleByChannel(OutHit, LastPosition, OffsetComponentToWorld.GetLocation()/*NextTransform.GetLocation()*/, FQuat::Identity, WalkingCollisionOverride, GetCollisionShape(), Params, ResponseParam);
+				}
 
 				if (bBlockingHit && OutHit.Component.IsValid())
 				{
@@ -618,6 +684,37 @@ void UVRRootComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 }
 
 
+bool UVRRootComponent::IsNearHMDSweepGeometry(const FCollisionQueryParams & Params, const FCollisionResponseParams & ResponseParam)
+{
+	UWorld * World = GetWorld();
+	if (!World)
+		return true;
+
+	const FVector CurLocation = OffsetComponentToWorld.GetLocation();
+	const float CurTime = World->GetTimeSeconds();
+
+	if (LastProximityCheckTime < 0.0f || (CurTime - LastProximityCheckTime) >= HMDSweepProximityInterval ||
+		FVector::DistSquared(CurLocation, ProximityCheckLocation) > FMath::Square(HMDSweepProximityDistance * 0.5f))
+	{
+		LastProximityCheckTime = CurTime;
+		ProximityCheckLocation = CurLocation;
+
+		FCollisionQueryParams ProximityParams(Params);
+		ProximityParams.bFindInitialOverlaps = false;
+
+		// Only grow out to the sides, growing the height would put the bottom into the floor and we would always be "near" something.
+		// If the wider radius turns it into a sphere then move it up so that its bottom stays where the capsules bottom is.
+		const float ProximityRadius = CapsuleRadius + HMDSweepProximityDistance;
+		const float ProximityHalfHeight = FMath::Max(CapsuleHalfHeight, ProximityRadius);
+		const FVector ProximityLocation = CurLocation + FVector(0.0f, 0.0f, ProximityHalfHeight - CapsuleHalfHeight);
+
+		bCachedNearGeometry = World->OverlapBlockingTestByChannel(ProximityLocation, FQuat::Identity, WalkingCollisionOverride,
+			FCollisionShape::MakeCapsule(ProximityRadius, ProximityHalfHeight), ProximityParams, ResponseParam);
+	}
+
+	return bCachedNearGeometry;
+}
+
 void UVRRootComponent::SendPhysicsTransform(ETeleportType Teleport)
 {
 	BodyInstance.SetBodyTransform(OffsetComponentToWorld, Teleport);
@@ -1131,9 +1228,10 @@ bool UVRRootComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* NewPending
 						NewOverlappingComponents.RemoveAllSwap(FPredicateFilterCannotOverlap(*this), false);
 					}
 				}
-				else
+				else if (!bUseOverlapCandidateCache || !GetOverlapsFromCandidateCache(NewOverlappingComponents, bIgnoreChildren))
 				{
 					UE_LOG(LogVRRootComponent, VeryVerbose, TEXT("%s->%s Performing overlaps!"), *GetNameSafe(GetOwner()), *GetName());
+					INC_DWORD_STAT(STAT_VRRootOverlapQueries);
 					UWorld* const MyWorld = MyActor->GetWorld();
 					TArray<FOverlapResult> Overlaps;
 					// note this will optionally include overlaps with components in the same actor (depending on bIgnoreChildren). 
@@ -1179,19 +1277,38 @@ bool UVRRootComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* NewPending
 				// what overlaps are in new and not in old (need begin overlap notifies).
 				// We do this by removing common entries from both lists, since overlapping status has not changed for them.
 				// What is left over will be what has changed.
-				for (int32 CompIdx = 0; CompIdx < OldOverlappingComponents.Num() && NewOverlappingComponents.Num() > 0; ++CompIdx)
+				// Hashing the new list keeps this linear instead of searching it for every old overlap.
+				if (NewOverlappingComponents.Num() > 0)
 				{
-					// RemoveSingleSwap is ok, since it is not necessary to maintain order
-					const bool bAllowShrinking = false;
+					TVROverlapIndexMap NewOverlapIndices;
+					NewOverlapIndices.Reserve(NewOverlappingComponents.Num());
+					for (int32 NewIdx = 0; NewIdx < NewOverlappingComponents.Num(); ++NewIdx)
+					{
+						NewOverlapIndices.Add(FVROverlapKey(NewOverlappingComponents[NewIdx]), NewIdx);
+					}
 
+					TArray<bool, TInlineAllocator<16>> StillOverlapping;
+					StillOverlapping.AddZeroed(NewOverlappingComponents.Num());
 
-					const FOverlapInfo& SearchItem = OldOverlappingComponents[CompIdx];
-					const int32 NewElementIdx = IndexOfOverlapFast(NewOverlappingComponents, SearchItem);
-					if (NewElementIdx != INDEX_NONE)
+					for (int32 CompIdx = 0; CompIdx < OldOverlappingComponents.Num(); ++CompIdx)
 					{
-						NewOverlappingComponents.RemoveAtSwap(NewElementIdx, 1, bAllowShrinking);
-						OldOverlappingComponents.RemoveAtSwap(CompIdx, 1, bAllowShrinking);
-						--CompIdx;
+						const int32* NewElementIdx = NewOverlapIndices.Find(FVROverlapKey(OldOverlappingComponents[CompIdx]));
+						if (NewElementIdx && !StillOverlapping[*NewElementIdx])
+						{
+							StillOverlapping[*NewElementIdx] = true;
+
+							// RemoveAtSwap is ok, since it is not necessary to maintain order
+							OldOverlappingComponents.RemoveAtSwap(CompIdx, 1, false);
+							--CompIdx;
+						}
+					}
+
+					for (int32 NewIdx = NewOverlappingComponents.Num() - 1; NewIdx >= 0; --NewIdx)
+					{
+						if (StillOverlapping[NewIdx])
+						{
+							NewOverlappingComponents.RemoveAt(NewIdx, 1, false);
+						}
 					}
 				}
 
@@ -1262,6 +1379,100 @@ bool UVRRootComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* NewPending
 }
 
 
+bool UVRRootComponent::GetOverlapsFromCandidateCache(TInlineOverlapInfoArray& OutOverlaps, bool bIgnoreChildren)
+{
+	AActor* const MyActor = GetOwner();
+	UWorld* const MyWorld = GetWorld();
+	if (!MyActor || !MyWorld)
+		return false;
+
+	const FBox CurrentBox = Bounds.GetBox();
+	const float CurTime = MyWorld->GetTimeSeconds();
+
+	if (!OverlapCandidateBox.IsValid || !OverlapCandidateBox.IsInside(CurrentBox) || (CurTime - OverlapCandidateTime) > OverlapCandidateMaxAge)
+	{
+		INC_DWORD_STAT(STAT_VRRootOverlapQueries);
+
+		OverlapCandidateBox = CurrentBox.ExpandBy(OverlapCandidateMargin);
+		OverlapCandidateTime = CurTime;
+		OverlapCandidates.Reset();
+
+		TArray<FOverlapResult> Overlaps;
+		FComponentQueryParams Params(SCENE_QUERY_STAT(UpdateOverlaps), bIgnoreChildren ? MyActor : nullptr);
+		Params.bIgnoreBlocks = true;
+		FCollisionResponseParams ResponseParam;
+		InitSweepCollisionParams(Params, ResponseParam);
+
+		MyWorld->OverlapMultiByChannel(Overlaps, OverlapCandidateBox.GetCenter(), FQuat::Identity, GetCollisionObjectType(), FCollisionShape::MakeBox(OverlapCandidateBox.GetExtent()), Params, ResponseParam);
+
+		for (const FOverlapResult& Result : Overlaps)
+		{
+			UPrimitiveComponent* const HitComp = Result.Component.Get();
+			if (HitComp && HitComp != this)
+			{
+				OverlapCandidates.Add(FOverlapInfo(HitComp, Result.ItemIndex));
+			}
+		}
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_VRRootOverlapCacheHits);
+	}
+
+	// Current overlaps are tested too, something that moved into us since the candidates were gathered already began its overlap from its own side
+	TVROverlapIndexMap TestedOverlaps;
+	const FCollisionQueryParams UnusedQueryParams(NAME_None, FCollisionQueryParams::GetUnknownStatId());
+	const FVector TestLocation = OffsetComponentToWorld.GetLocation();
+	const FQuat TestRotation = GetComponentQuat();
+
+	auto TestCandidate = [&](const FOverlapInfo& Candidate) -> bool
+	{
+		UPrimitiveComponent* const OtherPrimitive = Candidate.OverlapInfo.Component.Get();
+		if (!OtherPrimitive || !OtherPrimitive->GetGenerateOverlapEvents())
+			return true;
+
+		if (bIgnoreChildren && OtherPrimitive->GetOwner() == MyActor)
+			return true;
+
+		if (TestedOverlaps.Contains(FVROverlapKey(Candidate)))
+			return true;
+
+		TestedOverlaps.Add(FVROverlapKey(Candidate), 0);
+
+		// Same limits as the fast overlap check, can't test these against a single shape
+		if (OtherPrimitive->bMultiBodyOverlap || Cast<USkeletalMeshComponent>(OtherPrimitive))
+			return false;
+
+		if (!ShouldIgnoreOverlapResult(MyWorld, MyActor, *this, OtherPrimitive->GetOwner(), *OtherPrimitive, true) &&
+			OtherPrimitive->ComponentOverlapComponent(this, TestLocation, TestRotation, UnusedQueryParams))
+		{
+			OutOverlaps.Add(Candidate);
+		}
+
+		return true;
+	};
+
+	for (const FOverlapInfo& Candidate : OverlapCandidates)
+	{
+		if (!TestCandidate(Candidate))
+		{
+			OutOverlaps.Reset();
+			return false;
+		}
+	}
+
+	for (const FOverlapInfo& Current : OverlappingComponents)
+	{
+		if (!TestCandidate(Current))
+		{
+			OutOverlaps.Reset();
+			return false;
+		}
+	}
+
+	return true;
+}
+
 const TArray<FOverlapInfo>* UVRRootComponent::ConvertSweptOverlapsToCurrentOverlaps(
 	TArray<FOverlapInfo>& OverlapsAtEndLocation, const TArray<FOverlapInfo>& SweptOverlaps, int32 SweptOverlapsIndex,
 	const FVector& EndLocation, const FQuat& EndRotationQuat)
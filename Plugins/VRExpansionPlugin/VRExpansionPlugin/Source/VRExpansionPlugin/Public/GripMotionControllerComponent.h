@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
 #include "IMotionController.h"
+#include "WorldCollision.h"
 #include "SceneViewExtension.h"
 #include "VRBPDatatypes.h"
 #include "MotionControllerComponent.h"
@@ -18,6 +19,7 @@
 #include "GripMotionControllerComponent.generated.h"
 
 class AVRBaseCharacter;
+class UVRPoseSource;
 
 /**
 *
@@ -75,12 +77,26 @@ public:
 		FPrimitiveSceneInfo*	SceneInfo;
 	};
 
-	/** A utility method that calls CacheSceneInfo on ParentComponent and all of its descendants */
-	void GatherLateUpdatePrimitives(USceneComponent* ParentComponent);
+	/** A utility method that adds ParentComponent and all of its primitive descendants to OutComponents */
+	void GatherLateUpdatePrimitives(USceneComponent* ParentComponent, TArray<TWeakObjectPtr<UPrimitiveComponent>> & OutComponents);
 	void ProcessGripArrayLateUpdatePrimitives(UGripMotionControllerComponent* MotionController, TArray<FBPActorGripInformation> & GripArray);
 
 	/** Generates a LateUpdatePrimitiveInfo for the given component if it has a SceneProxy and appends it to the current LateUpdatePrimitives array */
-	void CacheSceneInfo(USceneComponent* Component);
+	void CacheSceneInfo(UPrimitiveComponent* Component);
+
+	/** Re-walks the controller hierarchy and additional late update components immediately, gripped object hierarchies are cleared and re-gathered as they are processed */
+	void RebuildComponentCache(UGripMotionControllerComponent* Component);
+
+	/** Controller hierarchy and additional late update components, only re-walked when the controllers late update generation changes */
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> CachedControllerComponents;
+	/** Component hierarchy of each gripped object, filled in the first time the object is seen after a rebuild */
+	TMap<const UObject*, TArray<TWeakObjectPtr<UPrimitiveComponent>>> CachedGripComponents;
+	/** AdditionalLateUpdateComponents at the time of the last rebuild, it is blueprint writable so it is compared directly */
+	TArray<UPrimitiveComponent*> CachedAdditionalComponents;
+
+	uint32 CachedGeneration;
+	int32 FramesSinceCacheRebuild;
+	bool bHasComponentCache;
 
 	/** Parent world transform used to reconstruct new world transforms for late update scene proxies */
 	FTransform LateUpdateParentToWorld[2];
@@ -94,6 +110,63 @@ public:
 
 };
 
+/**
+* Grips gathered for this ticks update, resolved once up front so that the base transforms can be composed together
+*/
+struct FGripTickEntry
+{
+	uint8 GripID;
+	bool bReplicatedArray;
+	bool bCustomGrip;
+	UObject * GrippedObject;
+	UPrimitiveComponent * Root;
+	AActor * Actor;
+	bool bRootHasInterface;
+	bool bActorHasInterface;
+
+	// No script would modify the default transform, the batch composed one can be used as is
+	bool bUseComposedTransform;
+
+	// Grip scripts aren't copied in here, they are read from the grips value cache when it is looked back up by ID
+};
+
+/**
+* Contiguous transform data for the gathered grips, RelativeTransform * AdditionTransform * ParentTransform is done for all of them in one vectorized pass
+*/
+struct VREXPANSIONPLUGIN_API FGripTickBatch
+{
+	TArray<FGripTickEntry> Entries;
+
+	// Same order as Entries
+	TArray<FQuat> RelativeRotations;
+	TArray<FVector> RelativeTranslations;
+	TArray<FVector> RelativeScales;
+	TArray<FQuat> AdditionRotations;
+	TArray<FVector> AdditionTranslations;
+	TArray<FVector> AdditionScales;
+	TArray<FTransform> WorldTransforms;
+
+	// Negative scales need the matrix path in FTransform::Multiply, these get composed the normal way
+	TArray<bool> NeedsMatrixCompose;
+
+	void Reset()
+	{
+		Entries.Reset();
+		RelativeRotations.Reset();
+		RelativeTranslations.Reset();
+		RelativeScales.Reset();
+		AdditionRotations.Reset();
+		AdditionTranslations.Reset();
+		AdditionScales.Reset();
+		WorldTransforms.Reset();
+		NeedsMatrixCompose.Reset();
+	}
+
+	FGripTickEntry & AddEntry(const FTransform & RelativeTransform, const FTransform & AdditionTransform);
+
+	void ComposeWorldTransforms(const FTransform & ParentTransform);
+};
+
 /**
 * An override of the MotionControllerComponent that implements position replication and Gripping with grip replication and controllable late updates per object.
 */
@@ -162,6 +235,11 @@ protected:
 	virtual void SendRenderTransform_Concurrent() override;
 	//~ End UActorComponent Interface.
 
+	//~ Begin USceneComponent Interface.
+	virtual void OnChildAttached(USceneComponent* ChildComponent) override;
+	virtual void OnChildDetached(USceneComponent* ChildComponent) override;
+	//~ End USceneComponent Interface.
+
 	FTransform GripRenderThreadRelativeTransform;
 	FVector GripRenderThreadComponentScale;
 	FTransform GripRenderThreadProfileTransform;
@@ -310,6 +388,17 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "GripMotionController")
 	TArray<UPrimitiveComponent *> AdditionalLateUpdateComponents;
 
+	// Bumped whenever grips or attachments change so that the late update manager re-gathers its primitives
+	uint32 LateUpdateGeneration;
+
+	// Forces the late update primitives to be re-gathered next frame
+	// Call this after attaching or detaching components on a held object if they need to late update right away
+	UFUNCTION(BlueprintCallable, Category = "GripMotionController")
+	void MarkLateUpdatePrimitivesDirty()
+	{
+		++LateUpdateGeneration;
+	}
+
 	//  Movement Replication
 	// Actor needs to be replicated for this to work
 
@@ -329,7 +418,11 @@ public:
 
 		if (bSmoothReplicatedMotion)
 		{
-			if (bReppedOnce)
+			if (bUseJitterBuffer)
+			{
+				AddNetSmoothingSample();
+			}
+			else if (bReppedOnce)
 			{
 				bLerpingPosition = true;
 				ControllerNetUpdateCount = 0.0f;
@@ -357,6 +450,28 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "GripMotionController|Networking")
 		bool bSmoothReplicatedMotion;
 
+	// When smoothing, buffer the remote updates and hermite interpolate through them JitterBufferPlayoutDelay behind the sender
+	// instead of lerping to the newest one, doesn't stall on a late or lost update so ControllerNetUpdateRate can be turned down
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking")
+		bool bUseJitterBuffer;
+
+	// How far behind the sender to play back buffered updates, around two send intervals covers a single lost update
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking", meta = (ClampMin = "0", UIMin = "0"))
+		float JitterBufferPlayoutDelay;
+
+	// How long to keep moving past the newest buffered update when the next one is late, it holds after this
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Networking", meta = (ClampMin = "0", UIMin = "0"))
+		float MaxExtrapolationTime;
+
+	// Senders timestamp for the next OnRep, set by the owning character from its pose packet
+	// Left below zero when sent by the component itself, the arrival time is used instead
+	float RemoteSampleTimeStamp;
+
+	FBPVRPosRepJitterBuffer NetSmoothingBuffer;
+
+	// Adds the current ReplicatedControllerTransform to the jitter buffer
+	void AddNetSmoothingSample();
+
 	// Whether to replicate even if no tracking (FPS or test characters)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "GripMotionController|Networking")
 		bool bReplicateWithoutTracking;
@@ -369,6 +484,13 @@ public:
 	typedef void (AVRBaseCharacter::*VRBaseCharTransformRPC_Pointer)(FBPVRComponentPosRep NewTransform);
 	VRBaseCharTransformRPC_Pointer OverrideSendTransform;
 
+	// Set by the owning character when it sends this controller as part of its combined pose packet
+	// Skips the RPC and the ReplicatedControllerTransform replication of this component
+	bool bReplicatesWithOwnerPose;
+
+	// Keyframe tracking when ReplicatedControllerTransform uses DeltaOneDecimal, encodes on the owning client and decodes on the server
+	FBPVRPosRepDeltaState NetDeltaState;
+
 	// Need this as I can't think of another way for an actor component to make sure it isn't on the server
 	inline bool IsLocallyControlled() const
 	{
@@ -549,6 +671,14 @@ public:
 	//UFUNCTION(Reliable, NetMulticast)
 	bool NotifyGrip(FBPActorGripInformation &NewGrip, bool bIsReInit = false);
 
+	// Resolves the interface implementations and grip scripts of a grip into its value cache so the tick doesn't have to
+	void CacheGripInterfaceData(FBPActorGripInformation &Grip, UPrimitiveComponent * root, AActor * actor);
+
+	// Forces the cached interface / grip script data for a grip to be re-resolved next tick
+	// Only needed if grip scripts are added or removed on the object while it is held
+	UFUNCTION(BlueprintCallable, Category = "GripMotionController")
+	void InvalidateGripInterfaceCache(const FBPActorGripInformation &Grip);
+
 	UFUNCTION(Reliable, NetMulticast)
 	void NotifyDrop(const FBPActorGripInformation &NewDrop, bool bSimulate);
 
@@ -670,8 +800,30 @@ public:
 	// Running the gripping logic in its own function as the main tick was getting bloated
 	void TickGrip(float DeltaTime);
 
-	// Splitting logic into separate function
-	void HandleGripArray(TArray<FBPActorGripInformation> &GrippedObjectsArray, const FTransform & ParentTransform, float DeltaTime, bool bReplicatedArray = false);
+	// Resolves the grips of an array that need to be moved this tick and adds them to GripTickBatch
+	void GatherGripArray(TArray<FBPActorGripInformation> &GrippedObjectsArray, bool bReplicatedArray = false);
+
+	// Runs the per grip logic for everything in GripTickBatch, after its transforms have been composed
+	void ProcessGripBatch(const FTransform & ParentTransform, float DeltaTime);
+
+	// Reused every tick to avoid re-allocating
+	FGripTickBatch GripTickBatch;
+
+	// A pending async sweep for a gripped component
+	struct FGripAsyncSweep
+	{
+		FTraceHandle Handle;
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		uint64 LastUsedFrame = 0;
+	};
+
+	// Async sweeps in flight, keyed by the component that they are sweeping
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, FGripAsyncSweep> GripAsyncSweeps;
+
+	// Sweeps a held component based on GripSweepMode, in async mode this returns the results from the sweep submitted last frame
+	// and updates Start / End to the ones that sweep used.
+	bool SweepGripComponent(TArray<FHitResult> & OutHits, UPrimitiveComponent * Component, FVector & Start, FVector & End, const FQuat & Rot, const FComponentQueryParams & Params);
 
 	// Gets the world transform of a grip, modified by secondary grips, returns if it has a valid transform, if not then this tick will be skipped for the object
 	bool GetGripWorldTransform(TArray<UVRGripScriptBase*>& GripScripts, float DeltaTime,FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport, bool &bForceADrop);
@@ -824,6 +976,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController")
 	bool bUseWithoutTracking;
 
+	// How the collision sweeps for interactive and sweep grip types are run
+	// Async queues them with the engines batched async traces and uses the results a frame late, which is cheaper with many held objects
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController")
+	EVRGripSweepMode GripSweepMode;
+
 	bool CheckComponentWithSweep(UPrimitiveComponent * ComponentToCheck, FVector Move, FRotator newOrientation, bool bSkipSimulatingComponents/*, bool & bHadBlockingHitOut*/);
 	
 	// For physics handle operations
@@ -890,6 +1047,11 @@ public:
 		return true;
 	}
 
+	// Supplies controller poses instead of the XR system (recorded file, procedural, etc), leave empty to use the live XR system
+	// Used for running VR characters without an HMD, such as simulated clients for load testing
+	UPROPERTY(EditAnywhere, Instanced, BlueprintReadWrite, Category = "GripMotionController|PoseSource")
+	UVRPoseSource * PoseSource;
+
 	/** If true, the Position and Orientation args will contain the most recent controller state */
 	virtual bool GripPollControllerState(FVector& Position, FRotator& Orientation, float WorldToMetersScale);
 
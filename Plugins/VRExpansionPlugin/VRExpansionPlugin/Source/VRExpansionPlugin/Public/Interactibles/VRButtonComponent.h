@@ -6,6 +6,7 @@
 #include "GripMotionControllerComponent.h"
 #include "MotionControllerComponent.h"
 #include "VRGripInterface.h"
+#include "VRInteractibleFunctionLibrary.h"
 //#include "VRBPDatatypes.h"
 //#include "VRExpansionFunctionLibrary.h"
 #include "VRButtonComponent.generated.h"
@@ -45,6 +46,7 @@ public:
 
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UFUNCTION(BlueprintPure, Category = "VRButtonComponent")
 	bool IsButtonInUse()
@@ -104,7 +106,7 @@ public:
 				this->SetRelativeLocation(InitialRelativeTransform.TransformPosition(SetAxisValue(NewDepth)), false);
 			}
 			else
-				this->SetComponentTickEnabled(true); // This will trigger the lerp to resting position
+				UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, true); // This will trigger the lerp to resting position
 
 		}break;
 		default:break;
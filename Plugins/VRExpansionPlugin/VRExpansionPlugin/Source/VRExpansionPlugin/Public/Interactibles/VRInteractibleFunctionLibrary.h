@@ -161,6 +161,14 @@ public:
 		return ValueToSnap;
 	}
 
+	// Registers or unregisters an interactible for tick, interactibles should only tick while gripped, lerping or carrying momentum
+	// Goes through the active / idle interactible stats, calling SetComponentTickEnabled directly bypasses them
+	static void Interactible_SetTickActive(UActorComponent * Interactible, bool bTickActive);
+
+	// Adds / removes an interactible to the active / idle stats, call after Super::BeginPlay and before Super::EndPlay
+	static void Interactible_AddToTickStats(UActorComponent * Interactible);
+	static void Interactible_RemoveFromTickStats(UActorComponent * Interactible);
+
 };	
 
 
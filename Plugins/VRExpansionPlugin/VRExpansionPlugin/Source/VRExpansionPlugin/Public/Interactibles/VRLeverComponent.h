@@ -259,7 +259,7 @@ public:
 			if (FMath::IsNearlyZero(MomentumAtDrop * DeltaTime, 0.1f))
 			{
 				MomentumAtDrop = 0.0f;
-				this->SetComponentTickEnabled(false);
+				UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
 				bIsLerping = false;
 				bReplicateMovement = true;
 				return;
@@ -294,7 +294,7 @@ public:
 			}
 			else
 			{
-				this->SetComponentTickEnabled(false);
+				UVRInteractibleFunctionLibrary::Interactible_SetTickActive(this, false);
 				bIsLerping = false;
 				bReplicateMovement = true;
 				this->SetRelativeRotation((FTransform(SetAxisValue(TargetAngle, FRotator::ZeroRotator)) * InitialRelativeTransform).Rotator());
@@ -403,6 +403,7 @@ public:
 
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRGripInterface")
 		EGripMovementReplicationSettings MovementReplicationSetting;
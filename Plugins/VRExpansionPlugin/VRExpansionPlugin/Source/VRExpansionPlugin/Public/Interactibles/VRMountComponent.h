@@ -85,6 +85,11 @@ public:
 
 	float LerpOutAlpha;
 
+	// If true the component ticks while held, all of the mounts own logic runs in TickGrip so it is off by default
+	// Turned on automatically at begin play if a blueprint implements tick, native subclasses that override TickComponent should set it
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMountComponent")
+		bool bNeedsTickWhileHeld;
+
 	// ------------------------------------------------
 	// Gameplay tag interface
 	// ------------------------------------------------
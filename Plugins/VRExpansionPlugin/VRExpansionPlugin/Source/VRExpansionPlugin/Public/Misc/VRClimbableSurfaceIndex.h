@@ -0,0 +1,101 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "GameFramework/Info.h"
+#include "VRClimbableSurfaceIndex.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogVRClimbableIndex, Log, All);
+
+// A top edge of a climbable surface, the outward normal is horizontal and points away from the surface
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVRClimbableLedge
+{
+	GENERATED_BODY()
+public:
+
+	UPROPERTY()
+		FVector Start;
+
+	UPROPERTY()
+		FVector End;
+
+	UPROPERTY()
+		FVector OutwardNormal;
+
+	FVRClimbableLedge()
+		: Start(FVector::ZeroVector)
+		, End(FVector::ZeroVector)
+		, OutwardNormal(FVector::ZeroVector)
+	{}
+};
+
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVRClimbableCell
+{
+	GENERATED_BODY()
+public:
+
+	UPROPERTY()
+		TArray<int32> LedgeIndices;
+};
+
+/**
+*	Per level index of the ledges on climbable geometry, built in the editor (BuildIndex) and saved with the map.
+*	Climbing movement uses it to skip the step up sweeps entirely when there is no ledge in reach of a tagged actor,
+*	the sweeps are then only ran to confirm a step up that the index says is possible.
+*/
+UCLASS(Blueprintable, ClassGroup = (VRExpansionPlugin), hidecategories = (Input, Rendering, Replication, Actor, LOD, Cooking))
+class VREXPANSIONPLUGIN_API AVRClimbableSurfaceIndex : public AInfo
+{
+	GENERATED_BODY()
+
+public:
+
+	AVRClimbableSurfaceIndex(const FObjectInitializer& ObjectInitializer);
+
+	// Actors in this level with this tag are indexed, and then trusted to only be climbable where the index has ledges
+	// Only actors whose collision is all static are indexed, and only the top edges of each components bounds become ledges
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ClimbableIndex")
+		FName ClimbableTag;
+
+	// Grid cell size for the index, should be around the size of a climbing step up
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ClimbableIndex", meta = (ClampMin = "10", UIMin = "10"))
+		float CellSize;
+
+	// Regenerates the index from the tagged actors in this level, re-run after changing climbable geometry
+	UFUNCTION(CallInEditor, BlueprintCallable, Category = "ClimbableIndex")
+		void BuildIndex();
+
+	// Returns true if Actor was part of the last index build
+	bool IsActorIndexed(const AActor * Actor) const;
+
+	// Returns true if a ledge with its top between MinZ and MaxZ is within Radius (horizontally) of Point
+	bool HasLedgeNear(const FVector & Point, float MinZ, float MaxZ, float Radius) const;
+
+	// Finds the index in Worlds levels that covers Actor, null if the actor isn't indexed
+	static const AVRClimbableSurfaceIndex * FindIndexForActor(const UWorld * World, const AActor * Actor);
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+
+	FIntVector GetCell(const FVector & Location) const;
+	void AddLedge(const FVector & Start, const FVector & End, const FVector & OutwardNormal);
+
+	UPROPERTY()
+		TArray<FVRClimbableLedge> Ledges;
+
+	UPROPERTY()
+		TMap<FIntVector, FVRClimbableCell> Cells;
+
+	UPROPERTY()
+		TArray<AActor*> IndexedActors;
+
+	// Filled from IndexedActors on begin play
+	TSet<const AActor*> IndexedActorLookup;
+
+	// Indices that have begun play, there is usually only one or one per streamed level
+	static TArray<TWeakObjectPtr<AVRClimbableSurfaceIndex>> ActiveIndices;
+};
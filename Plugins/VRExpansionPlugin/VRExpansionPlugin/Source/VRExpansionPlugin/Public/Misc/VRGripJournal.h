@@ -0,0 +1,164 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tickable.h"
+#include "UObject/ObjectKey.h"
+#include "VRBPDatatypes.h"
+
+class UGripMotionControllerComponent;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogVRGripJournal, Log, All);
+
+enum class EVRGripJournalRecordType : uint8
+{
+	ControllerPose,
+	Grip,
+	Drop,
+	GripReplication
+};
+
+/**
+* A single fixed size entry in the grip journal, names are stored as indices into the journals name table
+*/
+struct VREXPANSIONPLUGIN_API FVRGripJournalRecord
+{
+	uint32 Frame;
+	float WorldTime;
+	int32 ControllerName;
+	int32 ObjectName;
+	EVRGripJournalRecordType Type;
+	uint8 GripID;
+	uint8 GripCollisionType;
+	uint8 GripLateUpdateSetting;
+	uint8 GripMovementReplicationSetting;
+	bool bSimulate;
+	float Stiffness;
+	float Damping;
+
+	// Component relative pose for ControllerPose (controllers and cameras), grip relative transform for Grip
+	FVector Location;
+	FQuat Rotation;
+
+	FVRGripJournalRecord()
+		: Frame(0)
+		, WorldTime(0.0f)
+		, ControllerName(INDEX_NONE)
+		, ObjectName(INDEX_NONE)
+		, Type(EVRGripJournalRecordType::ControllerPose)
+		, GripID(0)
+		, GripCollisionType(0)
+		, GripLateUpdateSetting(0)
+		, GripMovementReplicationSetting(0)
+		, bSimulate(false)
+		, Stiffness(0.0f)
+		, Damping(0.0f)
+		, Location(FVector::ZeroVector)
+		, Rotation(FQuat::Identity)
+	{}
+
+	friend FArchive & operator<<(FArchive & Ar, FVRGripJournalRecord & Record);
+};
+
+/**
+* Records controller poses and grip / drop events per frame into a fixed size ring so that grip sessions can be replayed later.
+* Kept as a plain singleton so the hooks in the grip controller are a single bool check when not recording.
+*/
+class VREXPANSIONPLUGIN_API FVRGripJournal
+{
+public:
+
+	static FVRGripJournal & Get();
+
+	static bool IsRecording()
+	{
+		return bIsRecording;
+	}
+
+	// Clears the journal and starts recording, once MaxRecords is hit the oldest records are overwritten
+	void StartRecording(int32 MaxRecords);
+
+	// Stops recording and writes the journal out, returns false if the file couldn't be written
+	bool StopRecording(const FString & FilePath);
+
+	// Records the relative pose of a controller or camera
+	void RecordPose(const USceneComponent * Component);
+	// bSimulate is only used by drops
+	void RecordGripEvent(EVRGripJournalRecordType Type, const UGripMotionControllerComponent * Controller, const FBPActorGripInformation & Grip, bool bSimulate = false);
+
+	static bool LoadFromFile(const FString & FilePath, TArray<FString> & OutNames, TArray<FVRGripJournalRecord> & OutRecords);
+	static FString GetDefaultFilePath();
+
+	// Names objects so that they can be found again in a different world, components are prefixed with their owners name
+	static FString GetJournalName(const UObject * Object);
+
+private:
+
+	FVRGripJournal();
+
+	int32 GetNameIndex(const UObject * Object);
+	FVRGripJournalRecord & AddRecord(EVRGripJournalRecordType Type, const USceneComponent * Component);
+
+	static bool bIsRecording;
+
+	// Ring of records, NextRecord is the oldest once bWrapped is set
+	TArray<FVRGripJournalRecord> Records;
+	int32 MaxRecords;
+	int32 NextRecord;
+	bool bWrapped;
+
+	TArray<FString> Names;
+	TMap<FObjectKey, int32> NameLookup;
+};
+
+/**
+* Plays a loaded grip journal back into a world one recorded frame per tick, driving the named controllers directly so no HMD is needed.
+* Logs frame time stats when it finishes so that it can be used for regression benchmarks.
+*/
+class VREXPANSIONPLUGIN_API FVRGripJournalReplay : public FTickableGameObject
+{
+public:
+
+	FVRGripJournalReplay(UWorld * InWorld, TArray<FString> && InNames, TArray<FVRGripJournalRecord> && InRecords, bool bInExitWhenDone);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FVRGripJournalReplay, STATGROUP_Tickables);
+	}
+
+	bool IsFinished() const
+	{
+		return bFinished;
+	}
+
+	UWorld * GetReplayWorld() const
+	{
+		return World.Get();
+	}
+
+	// Called once the replay finishes, the replay can't delete itself from inside of its own tick
+	FSimpleDelegate OnReplayFinished;
+
+private:
+
+	UObject * FindJournalObject(int32 NameIndex);
+	void ApplyRecord(const FVRGripJournalRecord & Record);
+	void Finish();
+
+	TWeakObjectPtr<UWorld> World;
+	TArray<FString> Names;
+	TArray<FVRGripJournalRecord> Records;
+	TMap<int32, TWeakObjectPtr<UObject>> ResolvedObjects;
+
+	int32 NextRecord;
+	bool bFinished;
+	bool bExitWhenDone;
+
+	int32 FramesPlayed;
+	int32 MissingObjects;
+	double TotalFrameTime;
+	double MaxFrameTime;
+};
@@ -0,0 +1,127 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogVRMovementProfiler, Log, All);
+
+enum class EVRMovementPhase : uint8
+{
+	PhysWalking,
+	FindFloor,
+	StepUp,
+	MoveAlongFloor,
+	ServerCheckClientError,
+	SmoothCorrection,
+	Count
+};
+
+/**
+* Per character, per phase timings for the VR character movement, enabled with vre.MovementProfiler 1.
+* Phases are inclusive (FindFloor time also counts towards the StepUp or PhysWalking that called it).
+* Kept as a plain singleton so the scoped timers are a single int check when disabled.
+*/
+class VREXPANSIONPLUGIN_API FVRMovementProfiler
+{
+public:
+
+	// Frames kept for the rolling per frame cost
+	static const int32 WindowFrames = 120;
+
+	// Log2 microsecond buckets for single calls, the last bucket holds everything past ~16ms
+	static const int32 HistogramBuckets = 16;
+
+	struct FPhaseStats
+	{
+		uint64 Calls;
+		double TotalSeconds;
+		double MaxSeconds;
+		double FrameSeconds;
+		float Window[WindowFrames];
+		uint32 Histogram[HistogramBuckets];
+
+		FPhaseStats()
+		{
+			FMemory::Memzero(*this);
+		}
+
+		// Summed cost over the rolling window
+		double GetWindowTotal() const;
+	};
+
+	struct FCharacterStats
+	{
+		FString Name;
+		uint64 LastFrame;
+		int32 WindowIndex;
+		int32 WindowCount;
+		FPhaseStats Phases[(int32)EVRMovementPhase::Count];
+
+		FCharacterStats() : LastFrame(0), WindowIndex(0), WindowCount(0) {}
+
+		// The window only advances on new samples, so an idle or destroyed character would keep its last window forever
+		bool IsStale() const
+		{
+			return GFrameCounter - LastFrame > (uint64)WindowFrames;
+		}
+
+		// Zero once stale
+		double GetWindowAverage() const;
+		double GetPhaseWindowAverage(int32 PhaseIndex) const;
+	};
+
+	static FVRMovementProfiler & Get();
+
+	static bool IsEnabled()
+	{
+		return bEnabled != 0;
+	}
+
+	static const TCHAR * GetPhaseName(EVRMovementPhase Phase);
+
+	void AddSample(const UObject * Component, EVRMovementPhase Phase, uint64 Cycles);
+	void Reset();
+
+	// Logs the TopN characters by rolling cost with their phases, and the phase totals across every character
+	void Dump(int32 TopN) const;
+
+	// Writes one row per character and phase, returns false if the file couldn't be written
+	bool ExportCSV(const FString & FilePath) const;
+
+	static int32 bEnabled;
+
+private:
+
+	FVRMovementProfiler() {}
+
+	// Drops characters that haven't recorded a sample within the window (respawned or idle)
+	void RemoveStaleCharacters();
+
+	TMap<FObjectKey, FCharacterStats> Characters;
+};
+
+struct FVRScopedMovementPhase
+{
+	FVRScopedMovementPhase(const UObject * InComponent, EVRMovementPhase InPhase)
+		: Component(InComponent)
+		, Phase(InPhase)
+		, StartCycles(FVRMovementProfiler::IsEnabled() ? FPlatformTime::Cycles64() : 0)
+	{}
+
+	~FVRScopedMovementPhase()
+	{
+		if (StartCycles)
+		{
+			FVRMovementProfiler::Get().AddSample(Component, Phase, FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+private:
+	const UObject * Component;
+	EVRMovementPhase Phase;
+	uint64 StartCycles;
+};
+
+#define VR_SCOPE_MOVEMENT_PHASE(Phase) FVRScopedMovementPhase VRScopedMovementPhase_##Phase(this, EVRMovementPhase::Phase)
@@ -0,0 +1,137 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Math/RandomStream.h"
+#include "Misc/VRGripJournal.h"
+#include "VRPoseSource.generated.h"
+
+class USceneComponent;
+
+/**
+* Supplies tracked poses to a grip motion controller or replicated camera in place of the XR system.
+* Leave the components PoseSource empty to use the live XR system.
+*/
+UCLASS(Blueprintable, BlueprintType, EditInlineNew, DefaultToInstanced, Abstract, ClassGroup = (VRExpansionPlugin))
+class VREXPANSIONPLUGIN_API UVRPoseSource : public UObject
+{
+	GENERATED_BODY()
+public:
+
+	// Returns the relative pose for the target this frame, returning false counts as untracked
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "VRPoseSource")
+	bool GetPose(USceneComponent * Target, float DeltaTime, FVector & Position, FRotator & Orientation);
+	virtual bool GetPose_Implementation(USceneComponent * Target, float DeltaTime, FVector & Position, FRotator & Orientation);
+};
+
+UENUM(BlueprintType)
+enum class EVRProceduralPoseMode : uint8
+{
+	/** Wanders around the origin inside of WalkRadius, turning randomly. */
+	RandomWalk,
+
+	/** Stays at the origin and sweeps yaw and pitch back and forth like aiming between targets. */
+	AimSweep
+};
+
+/**
+* Generates poses procedurally, mainly for simulated clients so that replicated hands and heads actually move
+*/
+UCLASS(Blueprintable, BlueprintType, EditInlineNew, DefaultToInstanced, ClassGroup = (VRExpansionPlugin))
+class VREXPANSIONPLUGIN_API UVRPoseSource_Procedural : public UVRPoseSource
+{
+	GENERATED_BODY()
+public:
+
+	UVRPoseSource_Procedural(const FObjectInitializer& ObjectInitializer);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProceduralPose")
+	EVRProceduralPoseMode Mode;
+
+	// Relative pose that the motion is generated around
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProceduralPose")
+	FVector Origin;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProceduralPose")
+	FRotator OriginRotation;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProceduralPose|RandomWalk", meta = (ClampMin = "0", UIMin = "0"))
+	float WalkRadius;
+
+	// cm/s
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProceduralPose|RandomWalk", meta = (ClampMin = "0", UIMin = "0"))
+	float WalkSpeed;
+
+	// deg/s
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProceduralPose|RandomWalk", meta = (ClampMin = "0", UIMin = "0"))
+	float TurnSpeed;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProceduralPose|AimSweep", meta = (ClampMin = "0", UIMin = "0"))
+	float SweepYawRange;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProceduralPose|AimSweep", meta = (ClampMin = "0", UIMin = "0"))
+	float SweepPitchRange;
+
+	// Seconds for a full yaw sweep, pitch runs on a different period so the pattern doesn't repeat too obviously
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProceduralPose|AimSweep", meta = (ClampMin = "0.01", UIMin = "0.01"))
+	float SweepPeriod;
+
+	// 0 picks a random seed so that many simulated clients don't move in lock step
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProceduralPose")
+	int32 Seed;
+
+	virtual bool GetPose_Implementation(USceneComponent * Target, float DeltaTime, FVector & Position, FRotator & Orientation) override;
+
+private:
+
+	FRandomStream Stream;
+	bool bInitialized;
+	float ElapsedTime;
+	FVector WalkOffset;
+	FVector WalkVelocity;
+	FRotator WalkRotation;
+};
+
+/**
+* Plays a pose track back out of a grip journal file (see vr.GripJournal.Start / Stop)
+*/
+UCLASS(Blueprintable, BlueprintType, EditInlineNew, DefaultToInstanced, ClassGroup = (VRExpansionPlugin))
+class VREXPANSIONPLUGIN_API UVRPoseSource_File : public UVRPoseSource
+{
+	GENERATED_BODY()
+public:
+
+	UVRPoseSource_File(const FObjectInitializer& ObjectInitializer);
+
+	// Journal file to play, relative paths are relative to the project saved directory, empty uses the default journal path
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FilePose")
+	FString FilePath;
+
+	// Journal name of the component whose poses to play (Owner.Component), empty uses the targets own name
+	// Falls back to the first pose track in the file if the name isn't found
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FilePose")
+	FString TrackName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FilePose")
+	bool bLoop;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FilePose", meta = (ClampMin = "0", UIMin = "0"))
+	float PlayRate;
+
+	// Drops the loaded track so it is re-read on the next pose, call after changing FilePath or TrackName
+	UFUNCTION(BlueprintCallable, Category = "FilePose")
+	void ResetPlayback();
+
+	virtual bool GetPose_Implementation(USceneComponent * Target, float DeltaTime, FVector & Position, FRotator & Orientation) override;
+
+private:
+
+	bool LoadTrack(USceneComponent * Target);
+
+	TArray<FVRGripJournalRecord> Poses;
+	bool bLoadAttempted;
+	float PlaybackTime;
+	int32 Cursor;
+};
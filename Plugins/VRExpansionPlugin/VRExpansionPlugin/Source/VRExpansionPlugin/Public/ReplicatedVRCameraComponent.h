@@ -8,6 +8,7 @@
 #include "ReplicatedVRCameraComponent.generated.h"
 
 class AVRBaseCharacter;
+class UVRPoseSource;
 
 /**
 * An overridden camera component that replicates its location in multiplayer
@@ -22,7 +23,7 @@ public:
 
 
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
-	//virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
+	virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
 
 	/** Whether or not this component has authority within the frame*/
 	bool bHasAuthority;
@@ -34,6 +35,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ReplicatedCamera")
 	bool bSetPositionDuringTick;
 
+	// Supplies head poses instead of the XR system (recorded file, procedural, etc), leave empty to use the live XR system
+	// Applied during tick regardless of bSetPositionDuringTick, used for running VR characters without an HMD
+	UPROPERTY(EditAnywhere, Instanced, BlueprintReadWrite, Category = "ReplicatedCamera|PoseSource")
+	UVRPoseSource * PoseSource;
+
 	// If true will subtract the HMD's location from the position, useful for if the actors base is set to the HMD location always (simple character).
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ReplicatedCamera")
 	bool bOffsetByHMD;
@@ -57,13 +63,39 @@ public:
 	// Whether to smooth (lerp) between ticks for the replicated motion, DOES NOTHING if update rate is larger than FPS!
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "ReplicatedCamera|Networking")
 		bool bSmoothReplicatedMotion;
+
+	// When smoothing, buffer the remote updates and hermite interpolate through them JitterBufferPlayoutDelay behind the sender
+	// instead of lerping to the newest one, doesn't stall on a late or lost update so NetUpdateRate can be turned down
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ReplicatedCamera|Networking")
+		bool bUseJitterBuffer;
+
+	// How far behind the sender to play back buffered updates, around two send intervals covers a single lost update
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ReplicatedCamera|Networking", meta = (ClampMin = "0", UIMin = "0"))
+		float JitterBufferPlayoutDelay;
+
+	// How long to keep moving past the newest buffered update when the next one is late, it holds after this
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ReplicatedCamera|Networking", meta = (ClampMin = "0", UIMin = "0"))
+		float MaxExtrapolationTime;
+
+	// Senders timestamp for the next OnRep, set by the owning character from its pose packet
+	// Left below zero when sent by the component itself, the arrival time is used instead
+	float RemoteSampleTimeStamp;
+
+	FBPVRPosRepJitterBuffer NetSmoothingBuffer;
+
+	// Adds the current ReplicatedCameraTransform to the jitter buffer
+	void AddNetSmoothingSample();
 	
 	UFUNCTION()
 	virtual void OnRep_ReplicatedCameraTransform()
 	{
 		if (bSmoothReplicatedMotion)
 		{
-			if (bReppedOnce)
+			if (bUseJitterBuffer)
+			{
+				AddNetSmoothingSample();
+			}
+			else if (bReppedOnce)
 			{
 				bLerpingPosition = true;
 				NetUpdateCount = 0.0f;
@@ -95,6 +127,13 @@ public:
 	typedef void (AVRBaseCharacter::*VRBaseCharTransformRPC_Pointer)(FBPVRComponentPosRep NewTransform);
 	VRBaseCharTransformRPC_Pointer OverrideSendTransform;
 
+	// Set by the owning character when it sends this camera as part of its combined pose packet
+	// Skips the RPC and the ReplicatedCameraTransform replication of this component
+	bool bReplicatesWithOwnerPose;
+
+	// Keyframe tracking when ReplicatedCameraTransform uses DeltaOneDecimal, encodes on the owning client and decodes on the server
+	FBPVRPosRepDeltaState NetDeltaState;
+
 	// Need this as I can't think of another way for an actor component to make sure it isn't on the server
 	inline bool IsLocallyControlled() const
 	{
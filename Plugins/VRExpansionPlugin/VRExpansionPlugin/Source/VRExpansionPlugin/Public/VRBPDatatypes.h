@@ -303,7 +303,10 @@ enum class EVRVectorQuantization : uint8
 	/** Each vector component will be rounded, preserving one decimal place. */
 	RoundOneDecimal = 0,
 	/** Each vector component will be rounded, preserving two decimal places. */
-	RoundTwoDecimals = 1
+	RoundTwoDecimals = 1,
+	/** Sent as a small delta (one decimal place) from the last keyframe, with a full keyframe every vrexp.PosRepKeyframeInterval sends.
+	* If a keyframe is lost the receiver drops the deltas based on it and holds the last position until the next keyframe arrives. */
+	DeltaOneDecimal = 2
 };
 
 UENUM()
@@ -312,7 +315,9 @@ enum class EVRRotationQuantization : uint8
 	/** Each rotation component will be rounded to 10 bits (1024 values). */
 	RoundTo10Bits = 0,
 	/** Each rotation component will be rounded to a short. */
-	RoundToShort = 1
+	RoundToShort = 1,
+	/** Sent as the three smallest components of the quaternion at 10 bits each + the 2 bit index of the dropped one. */
+	SmallestThree = 2
 };
 
 
@@ -333,17 +338,24 @@ public:
 
 	// The quantization level to use for the rotation components
 	// Using 10 bits mode saves approx 2.25 bytes per replication.
+	// SmallestThree is 2 bits larger than 10 bits mode but has around a third of the error.
 	UPROPERTY(EditDefaultsOnly, Category = Replication, AdvancedDisplay)
 		EVRRotationQuantization RotationQuantizationLevel;
 
-	FORCEINLINE uint16 CompressAxisTo10BitShort(float Angle)
+	// Only used with EVRVectorQuantization::DeltaOneDecimal
+	// Filled in by FBPVRPosRepDeltaState::Encode on the sender and resolved by FBPVRPosRepDeltaState::Decode on the receiver
+	bool bIsKeyframe;
+	uint8 KeyframeID;
+	FIntVector QuantizedDelta;
+
+	FORCEINLINE static uint16 CompressAxisTo10BitShort(float Angle)
 	{
 		// map [0->360) to [0->1024) and mask off any winding
 		return FMath::RoundToInt(Angle * 1024.f / 360.f) & 0xFFFF;
 	}
 
 
-	FORCEINLINE float DecompressAxisFrom10BitShort(uint16 Angle)
+	FORCEINLINE static float DecompressAxisFrom10BitShort(uint16 Angle)
 	{
 		// map [0->1024) to [0->360)
 		return (Angle * 360.f / 1024.f);
@@ -351,52 +363,57 @@ public:
 
 	FBPVRComponentPosRep():
 		QuantizationLevel(EVRVectorQuantization::RoundTwoDecimals),
-		RotationQuantizationLevel(EVRRotationQuantization::RoundToShort)
+		RotationQuantizationLevel(EVRRotationQuantization::RoundToShort),
+		bIsKeyframe(true),
+		KeyframeID(0),
+		QuantizedDelta(FIntVector::ZeroValue)
 	{
 		//QuantizationLevel = EVRVectorQuantization::RoundTwoDecimals;
 		Position = FVector::ZeroVector;
 		Rotation = FRotator::ZeroRotator;
 	}
 
-	/** Network serialization */
-	// Doing a custom NetSerialize here because this is sent via RPCs and should change on every update
-	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	/**
+	*	Valid range 100: 2^22 / 100 = +/- 41,943.04 (419.43 meters)
+	*	Valid range 10: 2^18 / 10 = +/- 26,214.4 (262.144 meters)
+	*	Pos rep is assumed to be in relative space for a tracked component, these numbers should be fine
+	*/
+	static bool SerializeQuantizedPosition(FArchive& Ar, EVRVectorQuantization InQuantizationLevel, FVector & InOutPosition)
 	{
-		bOutSuccess = true;
+		switch (InQuantizationLevel)
+		{
+		case EVRVectorQuantization::RoundTwoDecimals: return SerializePackedVector<100, 22/*30*/>(InOutPosition, Ar); break;
+		case EVRVectorQuantization::RoundOneDecimal: return SerializePackedVector<10, 18/*24*/>(InOutPosition, Ar); break;
+		// Needs the keyframe data, handled in SerializeTransform
+		case EVRVectorQuantization::DeltaOneDecimal: break;
+		}
 
-		// Defines the level of Quantization
-		//uint8 Flags = (uint8)QuantizationLevel;
-		Ar.SerializeBits(&QuantizationLevel, 1); // Only two values 0:1
-		Ar.SerializeBits(&RotationQuantizationLevel, 1); // Only two values 0:1
+		return true;
+	}
 
-		// No longer using their built in rotation rep, as controllers will rarely if ever be at 0 rot on an axis and 
-		// so the 1 bit overhead per axis is just that, overhead
-		//Rotation.SerializeCompressedShort(Ar);
+	// No longer using their built in rotation rep, as controllers will rarely if ever be at 0 rot on an axis and 
+	// so the 1 bit overhead per axis is just that, overhead
+	static void SerializeQuantizedRotation(FArchive& Ar, EVRRotationQuantization InQuantizationLevel, FRotator & InOutRotation)
+	{
+		if (InQuantizationLevel == EVRRotationQuantization::SmallestThree)
+		{
+			SerializeSmallestThreeRotation(Ar, InOutRotation);
+			return;
+		}
 
 		uint16 ShortPitch = 0;
 		uint16 ShortYaw = 0;
 		uint16 ShortRoll = 0;
 		
-		/**
-		*	Valid range 100: 2^22 / 100 = +/- 41,943.04 (419.43 meters)
-		*	Valid range 10: 2^18 / 10 = +/- 26,214.4 (262.144 meters)
-		*	Pos rep is assumed to be in relative space for a tracked component, these numbers should be fine
-		*/
 		if (Ar.IsSaving())
 		{		
-			switch (QuantizationLevel)
-			{
-			case EVRVectorQuantization::RoundTwoDecimals: bOutSuccess &= SerializePackedVector<100, 22/*30*/>(Position, Ar); break;
-			case EVRVectorQuantization::RoundOneDecimal: bOutSuccess &= SerializePackedVector<10, 18/*24*/>(Position, Ar); break;
-			}
-
-			switch (RotationQuantizationLevel)
+			switch (InQuantizationLevel)
 			{
 			case EVRRotationQuantization::RoundTo10Bits:
 			{
-				ShortPitch = CompressAxisTo10BitShort(Rotation.Pitch);
-				ShortYaw = CompressAxisTo10BitShort(Rotation.Yaw);
-				ShortRoll = CompressAxisTo10BitShort(Rotation.Roll);
+				ShortPitch = CompressAxisTo10BitShort(InOutRotation.Pitch);
+				ShortYaw = CompressAxisTo10BitShort(InOutRotation.Yaw);
+				ShortRoll = CompressAxisTo10BitShort(InOutRotation.Roll);
 
 				Ar.SerializeBits(&ShortPitch, 10);
 				Ar.SerializeBits(&ShortYaw, 10);
@@ -405,9 +422,9 @@ public:
 
 			case EVRRotationQuantization::RoundToShort:
 			{
-				ShortPitch = FRotator::CompressAxisToShort(Rotation.Pitch);
-				ShortYaw = FRotator::CompressAxisToShort(Rotation.Yaw);
-				ShortRoll = FRotator::CompressAxisToShort(Rotation.Roll);
+				ShortPitch = FRotator::CompressAxisToShort(InOutRotation.Pitch);
+				ShortYaw = FRotator::CompressAxisToShort(InOutRotation.Yaw);
+				ShortRoll = FRotator::CompressAxisToShort(InOutRotation.Roll);
 
 				Ar << ShortPitch;
 				Ar << ShortYaw;
@@ -417,15 +434,7 @@ public:
 		}
 		else // If loading
 		{
-			//QuantizationLevel = (EVRVectorQuantization)Flags;
-
-			switch (QuantizationLevel)
-			{
-			case EVRVectorQuantization::RoundTwoDecimals: bOutSuccess &= SerializePackedVector<100, 22/*30*/>(Position, Ar); break;
-			case EVRVectorQuantization::RoundOneDecimal: bOutSuccess &= SerializePackedVector<10, 18/*24*/>(Position, Ar); break;
-			}
-
-			switch (RotationQuantizationLevel)
+			switch (InQuantizationLevel)
 			{
 			case EVRRotationQuantization::RoundTo10Bits:
 			{
@@ -433,9 +442,9 @@ public:
 				Ar.SerializeBits(&ShortYaw, 10);
 				Ar.SerializeBits(&ShortRoll, 10);
 
-				Rotation.Pitch = DecompressAxisFrom10BitShort(ShortPitch);
-				Rotation.Yaw = DecompressAxisFrom10BitShort(ShortYaw);
-				Rotation.Roll = DecompressAxisFrom10BitShort(ShortRoll);
+				InOutRotation.Pitch = DecompressAxisFrom10BitShort(ShortPitch);
+				InOutRotation.Yaw = DecompressAxisFrom10BitShort(ShortYaw);
+				InOutRotation.Roll = DecompressAxisFrom10BitShort(ShortRoll);
 			}break;
 
 			case EVRRotationQuantization::RoundToShort:
@@ -444,12 +453,65 @@ public:
 				Ar << ShortYaw;
 				Ar << ShortRoll;
 
-				Rotation.Pitch = FRotator::DecompressAxisFromShort(ShortPitch);
-				Rotation.Yaw = FRotator::DecompressAxisFromShort(ShortYaw);
-				Rotation.Roll = FRotator::DecompressAxisFromShort(ShortRoll);
+				InOutRotation.Pitch = FRotator::DecompressAxisFromShort(ShortPitch);
+				InOutRotation.Yaw = FRotator::DecompressAxisFromShort(ShortYaw);
+				InOutRotation.Roll = FRotator::DecompressAxisFromShort(ShortRoll);
 			}break;
 			}
 		}
+	}
+
+	// Largest component index + the other three quaternion components at 10 bits each (32 bits total)
+	static void SerializeSmallestThreeRotation(FArchive& Ar, FRotator & InOutRotation);
+
+	// Default levels (RoundTwoDecimals / RoundToShort) keep the original 1 bit each layout on the wire
+	// RoundOneDecimal and RoundTo10Bits carry one extra bit to select their DeltaOneDecimal / SmallestThree variants
+	static void SerializeQuantizationLevels(FArchive& Ar, EVRVectorQuantization & InOutQuantizationLevel, EVRRotationQuantization & InOutRotationQuantizationLevel)
+	{
+		uint8 bTwoDecimals = InOutQuantizationLevel == EVRVectorQuantization::RoundTwoDecimals;
+		Ar.SerializeBits(&bTwoDecimals, 1);
+
+		if (!bTwoDecimals)
+		{
+			uint8 bDelta = InOutQuantizationLevel == EVRVectorQuantization::DeltaOneDecimal;
+			Ar.SerializeBits(&bDelta, 1);
+
+			if (Ar.IsLoading())
+				InOutQuantizationLevel = bDelta ? EVRVectorQuantization::DeltaOneDecimal : EVRVectorQuantization::RoundOneDecimal;
+		}
+		else if (Ar.IsLoading())
+			InOutQuantizationLevel = EVRVectorQuantization::RoundTwoDecimals;
+
+		uint8 bShort = InOutRotationQuantizationLevel == EVRRotationQuantization::RoundToShort;
+		Ar.SerializeBits(&bShort, 1);
+
+		if (!bShort)
+		{
+			uint8 bSmallestThree = InOutRotationQuantizationLevel == EVRRotationQuantization::SmallestThree;
+			Ar.SerializeBits(&bSmallestThree, 1);
+
+			if (Ar.IsLoading())
+				InOutRotationQuantizationLevel = bSmallestThree ? EVRRotationQuantization::SmallestThree : EVRRotationQuantization::RoundTo10Bits;
+		}
+		else if (Ar.IsLoading())
+			InOutRotationQuantizationLevel = EVRRotationQuantization::RoundToShort;
+	}
+
+	// Serializes the position and rotation with the passed in levels, the levels themselves are not written
+	bool SerializeTransform(FArchive& Ar, EVRVectorQuantization InQuantizationLevel, EVRRotationQuantization InRotationQuantizationLevel);
+
+	/** Network serialization */
+	// Doing a custom NetSerialize here because this is sent via RPCs and should change on every update
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		bOutSuccess = true;
+
+		// Defines the level of Quantization
+		//uint8 Flags = (uint8)QuantizationLevel;
+		SerializeQuantizationLevels(Ar, QuantizationLevel, RotationQuantizationLevel);
+
+		//Rotation.SerializeCompressedShort(Ar);
+		bOutSuccess &= SerializeTransform(Ar, QuantizationLevel, RotationQuantizationLevel);
 
 		return bOutSuccess;
 	}
@@ -465,6 +527,182 @@ struct TStructOpsTypeTraits< FBPVRComponentPosRep > : public TStructOpsTypeTrait
 	};
 };
 
+// Keyframe tracking for EVRVectorQuantization::DeltaOneDecimal, one of these lives on each end of a replicated component stream
+// The sender only sends a delta from the last keyframe, the receiver drops deltas until it has the keyframe they are based on
+struct VREXPANSIONPLUGIN_API FBPVRPosRepDeltaState
+{
+	static const int32 KeyframeIDBits = 4;
+
+	// Deltas larger than this force a new keyframe, 12 bits is +/- 204.7cm in one decimal place
+	static const int32 MaxDeltaBits = 12;
+
+	// Position of the last keyframe in one decimal place units
+	FIntVector KeyframePosition;
+	uint8 KeyframeID;
+	int32 SamplesSinceKeyframe;
+	bool bHasKeyframe;
+
+	FBPVRPosRepDeltaState()
+	{
+		Reset();
+	}
+
+	void Reset()
+	{
+		KeyframePosition = FIntVector::ZeroValue;
+		KeyframeID = 0;
+		SamplesSinceKeyframe = 0;
+		bHasKeyframe = false;
+	}
+
+	// Sender side, fills out the keyframe / delta data of the rep right before it is sent, position is left alone
+	void Encode(FBPVRComponentPosRep & InOutRep);
+
+	// Receiver side, resolves a delta back into an absolute position and marks it as a keyframe so it re-replicates as one
+	// Returns false if the keyframe the delta is based on was lost, the rep should be thrown out in that case
+	bool Decode(FBPVRComponentPosRep & InOutRep);
+};
+
+// Timestamped buffer of received component reps for remote smoothing, played back a set delay behind the sender
+// Hermite interpolates between samples (squad for rotation) with tangents from the neighbouring samples, and extrapolates
+// for a short time past the newest sample so that a late or lost update doesn't stall the component
+struct VREXPANSIONPLUGIN_API FBPVRPosRepJitterBuffer
+{
+	struct FSample
+	{
+		float TimeStamp;
+		FVector Position;
+		FQuat Rotation;
+	};
+
+	static const int32 MaxSamples = 16;
+
+	TArray<FSample, TInlineAllocator<MaxSamples>> Samples;
+
+	// Estimate of local time - sender time, follows the least delayed sample
+	float ClockOffset;
+	bool bHasClockOffset;
+
+	FBPVRPosRepJitterBuffer() :
+		ClockOffset(0.0f),
+		bHasClockOffset(false)
+	{}
+
+	void Reset()
+	{
+		Samples.Reset();
+		ClockOffset = 0.0f;
+		bHasClockOffset = false;
+	}
+
+	// RemoteTimeStamp is the senders time for the sample, pass in the local time for both if the sender doesn't stamp them
+	void AddSample(float RemoteTimeStamp, float LocalTime, const FBPVRComponentPosRep & Rep);
+
+	// Returns false if nothing has been received yet
+	bool Evaluate(float LocalTime, float PlayoutDelay, float MaxExtrapolationTime, FVector & OutPosition, FRotator & OutRotation);
+};
+
+// A single sample of the HMD and both controllers, sent as one packet instead of three separate component reps
+// Shares a single quantization setting and timestamp between all of the tracked devices
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FBPVRCharacterPoseRep
+{
+	GENERATED_USTRUCT_BODY()
+public:
+
+	// Flags for which tracked devices are contained in a pose packet
+	enum EPoseRepFlags : uint8
+	{
+		PoseRep_HMD = 0x01,
+		PoseRep_LeftController = 0x02,
+		PoseRep_RightController = 0x04,
+		PoseRep_All = 0x07
+	};
+
+	UPROPERTY(Transient)
+		FBPVRComponentPosRep HMD;
+	UPROPERTY(Transient)
+		FBPVRComponentPosRep LeftController;
+	UPROPERTY(Transient)
+		FBPVRComponentPosRep RightController;
+
+	// World time on the owning client when this pose was sampled
+	UPROPERTY(Transient)
+		float TimeStamp;
+
+	// Which of the devices were sampled into this pose
+	UPROPERTY(Transient)
+		uint8 ContainedDevices;
+
+	// The quantization level to use for the vector components of all devices
+	UPROPERTY(EditDefaultsOnly, Category = Replication, AdvancedDisplay)
+		EVRVectorQuantization QuantizationLevel;
+
+	// The quantization level to use for the rotation components of all devices
+	UPROPERTY(EditDefaultsOnly, Category = Replication, AdvancedDisplay)
+		EVRRotationQuantization RotationQuantizationLevel;
+
+	FBPVRCharacterPoseRep() :
+		TimeStamp(0.0f),
+		ContainedDevices(0),
+		QuantizationLevel(EVRVectorQuantization::RoundTwoDecimals),
+		RotationQuantizationLevel(EVRRotationQuantization::RoundToShort)
+	{}
+
+	FORCEINLINE bool HasDevice(EPoseRepFlags Device) const
+	{
+		return (ContainedDevices & Device) != 0;
+	}
+
+	/** Network serialization */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		bOutSuccess = true;
+
+		FBPVRComponentPosRep::SerializeQuantizationLevels(Ar, QuantizationLevel, RotationQuantizationLevel);
+		Ar.SerializeBits(&ContainedDevices, 3);
+		Ar << TimeStamp;
+
+		FBPVRComponentPosRep * Devices[3] = { &HMD, &LeftController, &RightController };
+		for (int i = 0; i < 3; ++i)
+		{
+			if (ContainedDevices & (1 << i))
+			{
+				FBPVRComponentPosRep & Device = *Devices[i];
+
+				if (Ar.IsLoading())
+				{
+					Device.QuantizationLevel = QuantizationLevel;
+					Device.RotationQuantizationLevel = RotationQuantizationLevel;
+				}
+
+				bOutSuccess &= Device.SerializeTransform(Ar, QuantizationLevel, RotationQuantizationLevel);
+			}
+		}
+
+		return bOutSuccess;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits< FBPVRCharacterPoseRep > : public TStructOpsTypeTraitsBase2<FBPVRCharacterPoseRep>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+UENUM(Blueprintable)
+enum class EVRGripSweepMode : uint8
+{
+	/** Collision sweeps for held items run immediately on the game thread. */
+	Sync,
+
+	/** Collision sweeps are queued with the async trace system and their results are used the next frame, uses the simple collision shape of the component. */
+	AsyncOneFrameLatency
+};
+
 UENUM(Blueprintable)
 enum class EGripCollisionType : uint8
 {
@@ -1181,6 +1419,29 @@ public:
 		FName CachedBoneName;
 		uint8 CachedGripID;
 
+		// Interface and grip script lookups, resolved when the grip is set up instead of every tick
+		// Re-resolved if the gripped object or its root component changes or a cached script is destroyed.
+		// This struct isn't seen by the GC, so the raw script array is only trusted while its weak refs are still valid.
+		// Reset by ClearNonReppingItems, call InvalidateGripInterfaceCache if scripts are swapped on a held object.
+		bool bInterfaceCacheValid;
+		UObject * CachedInterfaceObject;
+		UPrimitiveComponent * CachedInterfaceRoot;
+		bool bCachedRootHasInterface;
+		bool bCachedActorHasInterface;
+		TArray<UVRGripScriptBase*> CachedGripScripts;
+		TArray<TWeakObjectPtr<UVRGripScriptBase>> CachedGripScriptRefs;
+
+		bool AreCachedGripScriptsValid() const
+		{
+			for (const TWeakObjectPtr<UVRGripScriptBase> & ScriptRef : CachedGripScriptRefs)
+			{
+				if (!ScriptRef.IsValid())
+					return false;
+			}
+
+			return true;
+		}
+
 		FGripValueCache() :
 			bWasInitiallyRepped(false),
 			bCachedHasSecondaryAttachment(false),
@@ -1190,7 +1451,12 @@ public:
 			CachedStiffness(1500.0f),
 			CachedDamping(200.0f),
 			CachedBoneName(NAME_None),
-			CachedGripID(INVALID_VRGRIP_ID)
+			CachedGripID(INVALID_VRGRIP_ID),
+			bInterfaceCacheValid(false),
+			CachedInterfaceObject(nullptr),
+			CachedInterfaceRoot(nullptr),
+			bCachedRootHasInterface(false),
+			bCachedActorHasInterface(false)
 		{}
 
 	}ValueCache;
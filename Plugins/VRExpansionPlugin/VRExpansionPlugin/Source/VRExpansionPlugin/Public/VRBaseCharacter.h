@@ -46,6 +46,10 @@ public:
 	bool bOriginalControlRotation;
 	bool bWasOverLimit;
 
+	// Head location the seat limits were last evaluated at, and if a seat change requires a re-evaluation
+	FVector LastEvaluatedLocation;
+	bool bNeedsEvaluation;
+
 	FVRSeatedCharacterInfo()
 	{
 		Clear();
@@ -64,6 +68,8 @@ public:
 		AllowedRadius = 40.0f;
 		AllowedRadiusThreshold = 20.0f;
 		CurrentThresholdScaler = 0.0f;
+		LastEvaluatedLocation = FVector::ZeroVector;
+		bNeedsEvaluation = true;
 	}
 
 	void ClearTempVals()
@@ -72,6 +78,7 @@ public:
 		bWasSeated = false;
 		bOriginalControlRotation = false;
 		CurrentThresholdScaler = 0.0f;
+		bNeedsEvaluation = true;
 	}
 
 
@@ -191,6 +198,39 @@ public:
 	UFUNCTION(Unreliable, Server, WithValidation)
 		void Server_SendTransformRightController(FBPVRComponentPosRep NewTransform);
 
+	// If true the HMD and both controllers are sampled together by the character and sent in a single pose packet
+	// instead of each component sending its own RPC and replicating its own transform.
+	// Remote clients receive all three from the same sample and timestamp.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VRBaseCharacter|Networking")
+		bool bUseCombinedPoseReplication;
+
+	// Rate to send the combined pose to the server, 100htz is default (same as the component defaults).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRBaseCharacter|Networking", meta = (ClampMin = "0", UIMin = "0"))
+		float PoseNetUpdateRate;
+
+	// Used in Tick() to accumulate before sending pose updates
+	float PoseNetUpdateCount;
+
+	// The last combined pose sample, only replicated when bUseCombinedPoseReplication is enabled
+	UPROPERTY(EditDefaultsOnly, ReplicatedUsing = OnRep_ReplicatedPose, Category = "VRBaseCharacter|Networking")
+		FBPVRCharacterPoseRep ReplicatedPose;
+
+	// Passes the combined pose on to the camera and controllers as if they had received it themselves
+	UFUNCTION()
+		virtual void OnRep_ReplicatedPose();
+
+	// I'm sending it unreliable because it is being resent pretty often
+	UFUNCTION(Unreliable, Server, WithValidation)
+		void Server_SendPose(FBPVRCharacterPoseRep NewPose);
+
+	// Samples the HMD and controllers and sends them if they changed, called from Tick when locally controlled
+	void TickPoseReplication(float DeltaTime);
+
+	// Applies the shared pose quantization to a device and delta encodes it against its components keyframes
+	void EncodePoseDevice(FBPVRComponentPosRep & Device, FBPVRPosRepDeltaState & DeltaState);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual void PostInitializeComponents() override;
 	virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
 
 	// If true will replicate the capsule height on to clients, allows for dynamic capsule height changes in multiplayer
@@ -294,6 +334,11 @@ public:
 	UPROPERTY(BlueprintReadOnly, Replicated, EditAnywhere, Category = "BaseVRCharacter", ReplicatedUsing = OnRep_SeatedCharInfo)
 	FVRSeatedCharacterInfo SeatInformation;
 
+	// How far (cm) the HMD has to move relative to the seat before the seat limits are re-evaluated
+	// Seat changes always re-evaluate, 0 evaluates on any movement at all
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "BaseVRCharacter|Seating", meta = (ClampMin = "0", UIMin = "0"))
+		float SeatEvaluationThreshold;
+
 	// Called when the seated mode is changed
 	UFUNCTION(BlueprintNativeEvent, Category = "BaseVRCharacter")
 		void OnSeatedModeChanged(bool bNewSeatedMode, bool bWasAlreadySeated);
@@ -311,18 +356,20 @@ public:
 	
 	void ZeroToSeatInformation()
 	{
+		SeatInformation.bNeedsEvaluation = true;
 		SetSeatRelativeLocationAndRotationVR(SeatInformation.StoredLocation, -SeatInformation.StoredLocation, FRotator(0.0f, -SeatInformation.StoredYaw, 0.0f), true);
 		LeftMotionController->PostTeleportMoveGrippedObjects();
 		RightMotionController->PostTeleportMoveGrippedObjects();
 	}
 	
-	// Called from the movement component
+	// Called from the movement component while seated, only evaluates the limits when the HMD moved or the seat changed
 	void TickSeatInformation(float DeltaTime);
 
 	UFUNCTION()
 	virtual void OnRep_SeatedCharInfo()
 	{
 		// Handle setting up the player here
+		SeatInformation.bNeedsEvaluation = true;
 
 		if (UPrimitiveComponent * root = Cast<UPrimitiveComponent>(GetRootComponent()))
 		{
@@ -545,6 +545,9 @@ public:
 	virtual void PrepMoveFor(ACharacter* Character) override;
 	virtual void CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter, APlayerController* PC, const FVector& OldStartLocation) override;
 
+	// Folds an older already performed move into this one without touching the character, used to shorten the replay list after a correction
+	virtual void CombineForReplay(const FSavedMove_VRBaseCharacter* OlderMove);
+
 	/** Set the properties describing the final position, etc. of the moved pawn. */
 	virtual void PostUpdate(ACharacter* C, EPostUpdateMode PostUpdateMode) override;
 };
@@ -562,6 +565,29 @@ public:
 	void RevertMove();
 };
 
+// Last computed floor, re-used while the capsule stays within a tolerance of where it was found on the same static floor
+struct FVRFloorCache
+{
+	FFindFloorResult Result;
+	FVector CapsuleLocation;
+	FVector FloorLocation;
+	float LineDistance;
+	float SweepDistance;
+	float SweepRadius;
+	TWeakObjectPtr<UPrimitiveComponent> FloorComponent;
+	TWeakObjectPtr<UPrimitiveComponent> MovementBase;
+	bool bValid;
+
+	FVRFloorCache()
+		: CapsuleLocation(FVector::ZeroVector)
+		, FloorLocation(FVector::ZeroVector)
+		, LineDistance(0.0f)
+		, SweepDistance(0.0f)
+		, SweepRadius(0.0f)
+		, bValid(false)
+	{}
+};
+
 UCLASS()
 class VREXPANSIONPLUGIN_API UVRBaseCharacterMovementComponent : public UCharacterMovementComponent
 {
@@ -759,6 +785,89 @@ public:
 
 	virtual void ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult = NULL) const override;
 
+	// The actual floor sweeps, ComputeFloorDist wraps this with the floor cache
+	void ComputeFloorDist_Uncached(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const;
+
+	// If true, re-uses the last floor result while the capsule stays within FloorCacheTolerance on the same static floor
+	// Room scale movement jitters the capsule every frame, which would otherwise re-sweep for the floor every tick
+	// Off by default, the cache isn't re-validated against the world so it can miss floors that change under a still capsule
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|FloorCache")
+		bool bUseFloorCache;
+
+	// How far (cm) the capsule can move from where the cached floor was found before sweeping again
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|FloorCache", meta = (ClampMin = "0", UIMin = "0"))
+		float FloorCacheTolerance;
+
+	// Forces the next floor check to sweep
+	UFUNCTION(BlueprintCallable, Category = "VRMovement|FloorCache")
+		void InvalidateFloorCache()
+	{
+		FloorCache.bValid = false;
+	}
+
+	virtual void OnTeleported() override;
+
+	mutable FVRFloorCache FloorCache;
+
+	bool CanUseFloorCache(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, float SweepRadius) const;
+
+	// Max saved moves to replay after a server correction, past this neighbouring moves are combined before replaying (0 is unlimited)
+	// Every replayed move re-runs the full movement sweeps, after a hitch at 90hz this can be dozens of moves in one frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Replay", meta = (ClampMin = "0", UIMin = "0"))
+		int32 ClientReplayBudget;
+
+	// If more than this many saved moves are waiting on a correction then they are thrown out and the servers position is taken as is (0 is off)
+	// The thrown out moves were already sent and the server still runs them, so a snap always costs at least one more correction after it.
+	// Only worth it when replaying would hitch worse than the extra correction, keep it well above ClientReplayBudget.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Replay", meta = (ClampMin = "0", UIMin = "0"))
+		int32 ClientReplaySnapThreshold;
+
+	// Allows combining pending moves on the client once this many saved moves are waiting on an ack, even if merging is otherwise off (0 is off)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Replay", meta = (ClampMin = "0", UIMin = "0"))
+		int32 AdaptiveMoveCombineThreshold;
+
+	bool ShouldForceMoveCombining(const FNetworkPredictionData_Client_Character* ClientData) const
+	{
+		return AdaptiveMoveCombineThreshold > 0 && ClientData && ClientData->SavedMoves.Num() >= AdaptiveMoveCombineThreshold;
+	}
+
+	// Trims the saved moves down to the replay budget, called after a correction is applied and before the moves are replayed
+	void ApplyClientReplayBudget();
+
+	// If true the server quantizes client move deltas to 0.1ms (the batched move grid) and steps them in FixedServerTimeStep sized pieces
+	// instead of the variable sub steps, so the same client move always simulates the same way no matter how large it is.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|ServerTimestep")
+		bool bUseFixedServerTimestep;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|ServerTimestep", meta = (ClampMin = "0.001", UIMin = "0.001", EditCondition = "bUseFixedServerTimestep"))
+		float FixedServerTimeStep;
+
+	// Max milliseconds per frame the server spends on this characters client moves, moves past it are deferred to the next frame (0 is unlimited)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|ServerTimestep", meta = (ClampMin = "0", UIMin = "0"))
+		float ServerMoveBudgetMs;
+
+	// Past this many deferred moves they are ran regardless of the budget so a slow client can't fall too far behind
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|ServerTimestep", meta = (ClampMin = "1", UIMin = "1"))
+		int32 MaxDeferredServerMoves;
+
+	bool IsOverServerMoveBudget();
+	void AddServerMoveCost(double Seconds);
+
+	virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel) override;
+	virtual float GetSimulationTimeStep(float RemainingTime, int32 Iterations) const override;
+
+	// Set while a fixed step server move is being performed
+	bool bInFixedServerStep;
+
+	// True while the server is nav walking a character that the owning client still simulates as walking
+	bool bIsServerNavWalking;
+
+	// PackNetworkMovementMode, except server only nav walking is sent as walking so clients and proxies never see it
+	uint8 PackNetworkMovementModeVR() const;
+
+	uint64 ServerMoveBudgetFrame;
+	double ServerMoveFrameSeconds;
+
 	// Need to use actual capsule location for step up
 	virtual bool VRClimbStepUp(const FVector& GravDir, const FVector& Delta, const FHitResult &InHit, FStepDownResult* OutStepDownResult = nullptr);
 
@@ -766,6 +875,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Climbing")
 		float VRClimbingStepHeight;
 
+	// If true, climbing into an actor covered by a VRClimbableSurfaceIndex only attempts the step up sweeps when the index has a ledge in reach
+	// Off by default, the index only has the top edges of each components bounds so ledges below that (shelves, stair or L shapes) get refused
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Climbing")
+		bool bUseClimbableSurfaceIndex;
+
+	// Returns false if the climbable index rules out stepping up from this hit, true if it allows it or doesn't cover the hit actor
+	bool CanClimbStepUpFromIndex(const FHitResult & Hit) const;
+
 	/* Custom distance that is required before accepting a climbing stepup
 	*  This is to help with cases where head wobble causes falling backwards
 	*  Do NOT set to larger than capsule radius!
@@ -871,6 +988,7 @@ public:
 		//this->CustomVRInputVector = FVector::ZeroVector;
 
 		Super::ClientAdjustPosition_Implementation(TimeStamp, NewLoc, NewVel, NewBase, NewBaseBoneName, bHasBase, bBaseRelativePosition, ServerMovementMode);
+		ApplyClientReplayBudget();
 	}
 
 	/* Bandwidth saving version, when velocity is zeroed */
@@ -25,6 +25,192 @@ class AVRCharacter;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogVRCharacterMovement, Log, All);
 
+// Client move that went over the servers per frame movement budget, ran at the start of the next tick
+struct FVRDeferredServerMove
+{
+	float TimeStamp;
+	FVector_NetQuantize10 InAccel;
+	FVector_NetQuantize100 ClientLoc;
+	FVector_NetQuantize100 CapsuleLoc;
+	FVRConditionalMoveRep ConditionalReps;
+	FVector_NetQuantize100 LFDiff;
+	uint16 CapsuleYaw;
+	uint8 MoveFlags;
+	FVRConditionalMoveRep2 MoveReps;
+	uint8 ClientMovementMode;
+
+	// Deferred ServerMoveOld, only TimeStamp, InAccel and MoveFlags are used
+	bool bIsOldMove;
+
+	// MoveReps holds the base raw, this keeps it from dangling while waiting
+	TWeakObjectPtr<UPrimitiveComponent> ClientMovementBase;
+};
+
+// How much simulation a remote (simulated proxy) character gets on this client
+UENUM(BlueprintType)
+enum class EVRProxySignificance : uint8
+{
+	// Full SimulateMovement every frame
+	ProxySig_Full,
+
+	// SimulateMovement at ProxyReducedUpdateRate, net updates are still handled right away
+	ProxySig_Reduced,
+
+	// Dead reckons along the replicated velocity with no sweeps or floor checks between net updates
+	ProxySig_Interpolated
+};
+
+// A single move inside of a FVRServerMoveBatch
+struct VREXPANSIONPLUGIN_API FVRBatchedMove
+{
+	float TimeStamp;
+	FVector Acceleration;
+	FVector CapsuleLoc;
+	FVRConditionalMoveRep ConditionalReps;
+	FVector LFDiff;
+	uint16 CapsuleYaw;
+
+	// Yaw in the low bits and pitch in the high bits, same as View0 in the dual RPCs
+	uint32 View;
+	uint8 MoveFlags;
+
+	// Move was made without root motion while the newest move in the batch has it
+	bool bIgnoreRootMotion;
+
+	FVRBatchedMove()
+	{
+		TimeStamp = 0.0f;
+		Acceleration = FVector::ZeroVector;
+		CapsuleLoc = FVector::ZeroVector;
+		LFDiff = FVector::ZeroVector;
+		CapsuleYaw = 0;
+		View = 0;
+		MoveFlags = 0;
+		bIgnoreRootMotion = false;
+	}
+};
+
+/**
+* Variable length batch of client moves, oldest first.
+* Only the newest timestamp is sent in full, the rest are delta encoded against the move after them in TimeStampTicksPerSecond units.
+* The movement base, bone, roll, client location and movement mode are shared and only apply to the newest move.
+*/
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVRServerMoveBatch
+{
+	GENERATED_USTRUCT_BODY()
+public:
+
+	static const int32 MaxMoves = 16;
+	static const int32 TimeStampTicksPerSecond = 10000;
+
+	TArray<FVRBatchedMove> Moves;
+
+	UPROPERTY(Transient)
+		FVector_NetQuantize100 ClientLoc;
+
+	UPROPERTY(Transient)
+		FVRConditionalMoveRep2 MoveReps;
+
+	UPROPERTY(Transient)
+		uint8 ClientMovementMode;
+
+	FVRServerMoveBatch()
+	{
+		ClientLoc = FVector::ZeroVector;
+		ClientMovementMode = 0;
+	}
+
+	/** Network serialization */
+	// Doing a custom NetSerialize here because this is sent via RPCs and should change on every update
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		bOutSuccess = true;
+
+		uint32 LastIndex = Moves.Num() > 0 ? (uint32)(Moves.Num() - 1) : 0;
+		Ar.SerializeInt(LastIndex, MaxMoves);
+
+		if (Ar.IsLoading())
+		{
+			Moves.Reset();
+			Moves.AddDefaulted(LastIndex + 1);
+		}
+		else if (!Moves.Num())
+		{
+			// Nothing to send, still write out a valid newest move so the reader doesn't desync
+			Moves.AddDefaulted();
+		}
+
+		FVRBatchedMove & NewestMove = Moves[LastIndex];
+		Ar << NewestMove.TimeStamp;
+
+		// Delta against the rebuilt timestamp instead of the real one so that rounding doesn't accumulate and both sides rebuild the same values
+		float RebuiltTimeStamp = NewestMove.TimeStamp;
+
+		for (int32 i = (int32)LastIndex; i >= 0; --i)
+		{
+			FVRBatchedMove & Move = Moves[i];
+			const bool bIsNewest = (i == (int32)LastIndex);
+
+			if (!bIsNewest)
+			{
+				uint32 DeltaTicks = 0;
+				if (Ar.IsSaving())
+				{
+					DeltaTicks = (uint32)FMath::Max(FMath::RoundToInt((RebuiltTimeStamp - Move.TimeStamp) * TimeStampTicksPerSecond), 1);
+				}
+
+				Ar.SerializeIntPacked(DeltaTicks);
+				RebuiltTimeStamp -= (float)DeltaTicks / TimeStampTicksPerSecond;
+
+				if (Ar.IsLoading())
+				{
+					Move.TimeStamp = RebuiltTimeStamp;
+				}
+
+				Ar.SerializeBits(&Move.bIgnoreRootMotion, 1);
+				Ar.SerializeIntPacked(Move.View);
+			}
+
+			Ar << Move.MoveFlags;
+
+			// Same as the ExLight RPCs, skip acceleration entirely when there isn't any
+			bool bHasAccel = !Move.Acceleration.IsZero();
+			Ar.SerializeBits(&bHasAccel, 1);
+
+			if (bHasAccel)
+				bOutSuccess &= SerializePackedVector<10, 24>(Move.Acceleration, Ar);
+			else if (Ar.IsLoading())
+				Move.Acceleration = FVector::ZeroVector;
+
+			bOutSuccess &= SerializePackedVector<100, 30>(Move.CapsuleLoc, Ar);
+			bOutSuccess &= SerializePackedVector<100, 30>(Move.LFDiff, Ar);
+			Ar << Move.CapsuleYaw;
+			Move.ConditionalReps.NetSerialize(Ar, Map, bOutSuccess);
+		}
+
+		bOutSuccess &= SerializePackedVector<100, 30>(ClientLoc, Ar);
+		MoveReps.NetSerialize(Ar, Map, bOutSuccess);
+		Ar << ClientMovementMode;
+
+		if (Ar.IsLoading())
+		{
+			NewestMove.View = (((uint32)MoveReps.ClientPitch) << 16) | ((uint32)MoveReps.ClientYaw);
+		}
+
+		return bOutSuccess && !Ar.IsError();
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits< FVRServerMoveBatch > : public TStructOpsTypeTraitsBase2<FVRServerMoveBatch>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
 /** Shared pointer for easy memory management of FSavedMove_Character, for accumulating and replaying network moves. */
 //typedef TSharedPtr<class FSavedMove_Character> FSavedMovePtr;
 
@@ -69,6 +255,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent")
 	bool bAllowMovementMerging;
 
+	// Sends client moves through the single variable length ServerMoveVRBatch RPC instead of the ServerMoveVR variants.
+	// The newest unacknowledged moves are resent in each batch so that the server can recover from dropped packets without correcting.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Networking")
+	bool bUseServerMoveBatching;
+
+	// Max moves per batch including the newest one, the oldest important move can be added on top of this
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Networking", meta = (ClampMin = "2", UIMin = "2", ClampMax = "15", UIMax = "15", EditCondition = "bUseServerMoveBatching"))
+	int32 ServerMoveBatchSize;
+
 	// Higher values will cause more slide but better step up
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent", meta = (ClampMin = "0.01", UIMin = "0", ClampMax = "1.0", UIMax = "1"))
 	float WallRepulsionMultiplier;
@@ -106,13 +301,77 @@ public:
 	* @return True if movement mode was successfully changed
 	*/
 	virtual bool TryToLeaveNavWalking() override;
+
+	// Skipped while server nav walking, the capsule keeps its world collision so traces and overlaps against the pawn still work
+	virtual void SetNavWalkingPhysics(bool bEnable) override;
 	
 	
 	virtual void PhysNavWalking(float deltaTime, int32 Iterations) override;
 	virtual void ProcessLanded(const FHitResult& Hit, float remainingTime, int32 Iterations) override;
 
+	// If true the server moves remote clients walking on navmesh by projecting onto the navmesh instead of sweeping against full collision.
+	// Drops back to full walking near movable obstacles or when off of the navmesh, the owning client always simulates normal walking.
+	// Unlike normal nav walking the capsules collision responses are left alone, only the movement itself stops sweeping.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|ServerNavWalking")
+	bool bUseServerNavWalking;
+
+	// Movable objects (physics bodies, pawns, doors) within this distance of the capsule switch back to full walking
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|ServerNavWalking", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseServerNavWalking"))
+	float ServerNavWalkingObstacleDistance;
+
+	// Seconds between obstacle / navmesh checks
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|ServerNavWalking", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseServerNavWalking"))
+	float ServerNavWalkingCheckInterval;
+
+	float ServerNavWalkingTimer;
+	bool bSavedProjectNavMeshWalking;
+	bool bSavedSweepWhileNavWalking;
+
+	// Called on the server before each client move is performed
+	void UpdateServerNavWalking(float DeltaTime);
+	bool HasServerNavWalkingObstacle() const;
+	void EndServerNavWalking();
+
 	void PostPhysicsTickComponent(float DeltaTime, FCharacterMovementComponentPostPhysicsTickFunction& ThisTickFunction) override;
 	void SimulateMovement(float DeltaSeconds) override;
+
+	// Re-buckets this proxy every ProxySignificanceInterval, returns false if SimulateMovement should be skipped this frame
+	// DeltaSeconds is changed to the accumulated time when running at a reduced rate
+	bool UpdateProxySignificance(float & DeltaSeconds);
+	EVRProxySignificance EvaluateProxySignificance() const;
+	void SimulateInterpolatedProxy(float DeltaSeconds);
+
+	// If true then remote characters are bucketed by distance / screen size to the local view and distant ones are simulated less
+	// Off by default, reduced rate proxies can visibly stutter and skip overlap events that gameplay may rely on
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|ProxySignificance")
+	bool bUseProxySignificance;
+
+	// Proxies inside of this distance (cm) always get full simulation
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|ProxySignificance", meta = (ClampMin = "0", UIMin = "0"))
+	float ProxyFullDistance;
+
+	// Proxies past this distance (cm) or smaller than ProxyInterpolateScreenSize only interpolate
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|ProxySignificance", meta = (ClampMin = "0", UIMin = "0"))
+	float ProxyInterpolateDistance;
+
+	// Capsule bounds radius as a fraction of the half view width
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|ProxySignificance", meta = (ClampMin = "0", UIMin = "0"))
+	float ProxyInterpolateScreenSize;
+
+	// Simulation rate (hz) for proxies in the reduced bucket
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|ProxySignificance", meta = (ClampMin = "1", UIMin = "1"))
+	float ProxyReducedUpdateRate;
+
+	// Seconds between re-bucketing
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|ProxySignificance", meta = (ClampMin = "0", UIMin = "0"))
+	float ProxySignificanceInterval;
+
+	UPROPERTY(BlueprintReadOnly, Transient, Category = "VRCharacterMovementComponent|ProxySignificance")
+	EVRProxySignificance ProxySignificance;
+
+	float ProxySignificanceTimer;
+	float ProxyAccumulatedDelta;
+
 	void MoveSmooth(const FVector& InVelocity, const float DeltaSeconds, FStepDownResult* OutStepDownResult) override;
 	//void PerformMovement(float DeltaSeconds) override;
 
@@ -126,6 +385,42 @@ public:
 	///////////////////////////
 
 	virtual void SendClientAdjustment() override;
+
+	// If true the servers position error tolerance for this client grows with its recent (steady) error and ping instead of the static
+	// game network manager value, so small constant HMD driven desyncs stop triggering corrections
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Corrections")
+	bool bUseAdaptiveCorrectionTolerance;
+
+	// How much of the clients average error is added to the tolerance
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Corrections", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseAdaptiveCorrectionTolerance"))
+	float AdaptiveCorrectionErrorScale;
+
+	// cm of tolerance added per ms of ping
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Corrections", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseAdaptiveCorrectionTolerance"))
+	float AdaptiveCorrectionPingScale;
+
+	// The tolerance never grows past this (cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Corrections", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseAdaptiveCorrectionTolerance"))
+	float AdaptiveCorrectionMaxTolerance;
+
+	// Corrections within this distance (and velocity) of the last one sent are dropped until it has had a round trip to arrive, 0 is off
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Corrections", meta = (ClampMin = "0", UIMin = "0"))
+	float CorrectionDedupDistance;
+
+	// Corrections sent to this client over the last minute, server only
+	UFUNCTION(BlueprintPure, Category = "VRCharacterMovementComponent|Corrections")
+	int32 GetCorrectionsPerMinute() const;
+
+	float GetAdaptiveCorrectionTolerance() const;
+
+	// Smoothed position error of this clients moves
+	float ClientErrorAverage;
+
+	FVector LastCorrectionLoc;
+	FVector LastCorrectionVel;
+	TWeakObjectPtr<UPrimitiveComponent> LastCorrectionBase;
+	float LastCorrectionTime;
+	TArray<float> RecentCorrectionTimes;
 	/**
 	* Have the server check if the client is outside an error tolerance, and queue a client adjustment if so.
 	* If either GetPredictionData_Server_Character()->bForceClientUpdate or ServerCheckClientError() are true, the client adjustment will be sent.
@@ -202,6 +497,28 @@ public:
 	virtual void ServerMoveVRDualHybridRootMotion_Implementation(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode);
 	virtual bool ServerMoveVRDualHybridRootMotion_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode);
 
+	/** Replicated function sent by client to server - contains a variable length batch of moves, used when bUseServerMoveBatching is on. */
+	//UFUNCTION(unreliable, server, WithValidation)
+	virtual void ServerMoveVRBatch(const FVRServerMoveBatch& MoveBatch);
+	virtual void ServerMoveVRBatch_Implementation(const FVRServerMoveBatch& MoveBatch);
+	virtual bool ServerMoveVRBatch_Validate(const FVRServerMoveBatch& MoveBatch);
+
+	// Queued behind any deferred moves, running it right away would move CurrentClientTimeStamp past them
+	virtual void ServerMoveOld_Implementation(float OldTimeStamp, FVector_NetQuantize10 OldAccel, uint8 OldMoveFlags) override;
+
+	// Moves deferred by ServerMoveBudgetMs, oldest first
+	TArray<FVRDeferredServerMove> DeferredServerMoves;
+	bool bIsRunningDeferredServerMoves;
+
+	// Runs deferred moves oldest first until over the budget, or all of them if bIgnoreBudget is set
+	void ProcessDeferredServerMoves(bool bIgnoreBudget = false);
+
+	// True if a move with this timestamp is already waiting in DeferredServerMoves
+	bool IsServerMoveDeferred(float TimeStamp, float Tolerance) const;
+
+	// Fills out a batch with the newest unacknowledged moves ending in NewMove
+	virtual void BuildServerMoveBatch(const class FSavedMove_VRCharacter* NewMove, const class FSavedMove_VRCharacter* OldMove, const FVector& SendLocation, const FVRConditionalMoveRep2& NewMoveConds, FVRServerMoveBatch& OutBatch);
+
 	FNetworkPredictionData_Client* GetPredictionData_Client() const override;
 	FNetworkPredictionData_Server* GetPredictionData_Server() const override;
 
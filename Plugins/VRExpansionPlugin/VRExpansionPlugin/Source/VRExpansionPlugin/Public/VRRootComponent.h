@@ -18,6 +18,10 @@ DECLARE_LOG_CATEGORY_EXTERN(LogVRRootComponent, Log, All);
 DECLARE_STATS_GROUP(TEXT("VRRootComponent"), STATGROUP_VRRootComponent, STATCAT_Advanced);
 DECLARE_CYCLE_STAT(TEXT("VR Root Set Half Height"), STAT_VRRootSetHalfHeight, STATGROUP_VRRootComponent);
 DECLARE_CYCLE_STAT(TEXT("VR Root Set Capsule Size"), STAT_VRRootSetCapsuleSize, STATGROUP_VRRootComponent);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Root HMD Sweeps"), STAT_VRRootHMDSweeps, STATGROUP_VRRootComponent);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Root HMD Sweeps Coalesced"), STAT_VRRootHMDSweepsCoalesced, STATGROUP_VRRootComponent);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Root Overlap Queries"), STAT_VRRootOverlapQueries, STATGROUP_VRRootComponent);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR Root Overlap Cache Hits"), STAT_VRRootOverlapCacheHits, STATGROUP_VRRootComponent);
 
 /**
 * A capsule component that repositions its physics scene and rendering location to the camera/HMD's relative position.
@@ -85,6 +89,9 @@ protected:
 	TArray<FOverlapInfo>& OverlapsAtEndLocation, const TArray<FOverlapInfo>& SweptOverlaps, int32 SweptOverlapsIndex,
 	const FVector& EndLocation, const FQuat& EndRotationQuat);
 
+	// Fills the current overlaps from the candidate cache, returns false if a full overlap query is needed instead
+	bool GetOverlapsFromCandidateCache(TArray<FOverlapInfo, TInlineAllocator<3>>& OutOverlaps, bool bIgnoreChildren);
+
 public:
 	void BeginPlay() override;
 
@@ -137,6 +144,48 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary")
 	TEnumAsByte<ECollisionChannel> WalkingCollisionOverride;
 
+	// If true the walking collision sweep for HMD movement is skipped until the head has moved HMDSweepCoalesceDistance since the last sweep,
+	// unless the capsule is within HMDSweepProximityDistance of something it could collide with. Cuts out the sweeps from head micro motion.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary|HMDSweepCoalescing", meta = (EditCondition = "bUseWalkingCollisionOverride"))
+	bool bCoalesceHMDSweeps;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary|HMDSweepCoalescing", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bCoalesceHMDSweeps"))
+	float HMDSweepCoalesceDistance;
+
+	// Extra radius around the capsule that counts as being near geometry, every HMD move is swept while near
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary|HMDSweepCoalescing", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bCoalesceHMDSweeps"))
+	float HMDSweepProximityDistance;
+
+	// How often the near geometry check is refreshed, it is also refreshed when the capsule moves half of the proximity distance
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary|HMDSweepCoalescing", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bCoalesceHMDSweeps"))
+	float HMDSweepProximityInterval;
+
+	bool IsNearHMDSweepGeometry(const FCollisionQueryParams & Params, const FCollisionResponseParams & ResponseParam);
+
+	// If true overlap updates query the world once for everything within OverlapCandidateMargin of the capsule and only re-test those
+	// candidates (plus current overlaps) until the capsule bounds leave the expanded box, instead of a full overlap query on every move.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary|OverlapCache")
+	bool bUseOverlapCandidateCache;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary|OverlapCache", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseOverlapCandidateCache"))
+	float OverlapCandidateMargin;
+
+	// Seconds before the candidates are re-queried even if the capsule stayed inside of the box, picks up anything spawned or changed nearby
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary|OverlapCache", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseOverlapCandidateCache"))
+	float OverlapCandidateMaxAge;
+
+	FBox OverlapCandidateBox;
+	float OverlapCandidateTime;
+	TArray<FOverlapInfo> OverlapCandidates;
+
+	// Capsule relative start of the coalesced sweep
+	FVector CoalescedSweepStart;
+	bool bHasCoalescedSweep;
+
+	FVector ProximityCheckLocation;
+	float LastProximityCheckTime;
+	bool bCachedNearGeometry;
+
 	/*ECollisionChannel GetVRCollisionObjectType()
 	{
 		if (bUseWalkingCollisionOverride)
@@ -5,7 +5,27 @@
 
 AABCharacterBase::AABCharacterBase(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
+	// Send the HMD and both hands in one pose packet
+	bUseCombinedPoseReplication = true;
 
+	// Buffer remote heads and hands so they stay smooth at lower send rates
+	if (VRReplicatedCamera)
+	{
+		VRReplicatedCamera->bSmoothReplicatedMotion = true;
+		VRReplicatedCamera->bUseJitterBuffer = true;
+	}
+
+	if (LeftMotionController)
+	{
+		LeftMotionController->bSmoothReplicatedMotion = true;
+		LeftMotionController->bUseJitterBuffer = true;
+	}
+
+	if (RightMotionController)
+	{
+		RightMotionController->bSmoothReplicatedMotion = true;
+		RightMotionController->bUseJitterBuffer = true;
+	}
 }
 
 bool AABCharacterBase::GetMovementAxisForHand(float& Right, float& Forward, UMotionControllerComponent* Hand)